@@ -0,0 +1,60 @@
+#!/bin/bash
+# Checks the load balancing of the hybrid program (--balance) against the static blocks.
+#
+# A grid is made whose live cells crowd into its top left corner: the corner is a random soup, the rest of the grid is
+# almost empty. The hybrid program runs it once with the static blocks and once with --balance, both with --sparse so
+# the empty blocks have little to compute. Both runs have to write the same last generation, the execution times show
+# what the balancing gains.
+#
+# Usage: ./balance_check.sh [processes] [threads] [generations] [size] [balance_every]
+# Options of mpirun go into MPIRUN_OPTIONS, for example MPIRUN_OPTIONS=--oversubscribe
+#
+# @author Md. Ahsan Ayub
+# @version 1.0 10/18/2026
+
+iProcesses=${1:-4}
+iThreads=${2:-2}
+iGenerations=${3:-500}
+iSize=${4:-2048}
+iBalanceEvery=${5:-50}
+
+sDirectory=$(mktemp -d)
+trap 'rm -rf "$sDirectory"' EXIT
+
+# The skewed grid: a soup of density 1/2 in the top left quarter (a quarter of the rows and of the columns), a cell
+# in a thousand alive elsewhere. The seed is fixed, every run checks the same grid.
+awk -v n="$iSize" 'BEGIN {
+	srand(1);
+	print n " " n;
+	for(i = 0; i < n; i++)
+	{
+		sLine = "";
+		for(j = 0; j < n; j++)
+		{
+			dDensity = (i < n / 4 && j < n / 4) ? 0.5 : 0.001;
+			sLine = sLine (rand() < dDensity ? "1 " : "0 ");
+		}
+		print sLine;
+	}
+}' > "$sDirectory/skewed.txt"
+
+sMpirun="mpirun -np $iProcesses $MPIRUN_OPTIONS"
+[ "$(id -u)" = 0 ] && sMpirun="$sMpirun --allow-run-as-root"
+
+echo "Grid: $iSize * $iSize, live cells in the top left corner | Processes: $iProcesses | Threads: $iThreads | Generations: $iGenerations"
+
+# Static blocks
+$sMpirun ./hybrid "$sDirectory/skewed.txt" "$iThreads" "$iGenerations" "$sDirectory/static.txt" --sparse > "$sDirectory/static.log" || exit 1
+echo "Static:   $(grep 'Execution time' "$sDirectory/static.log")"
+
+# Balanced blocks
+$sMpirun ./hybrid "$sDirectory/skewed.txt" "$iThreads" "$iGenerations" "$sDirectory/balanced.txt" --sparse --balance "$iBalanceEvery" > "$sDirectory/balanced.log" || exit 1
+echo "Balanced: $(grep 'Execution time' "$sDirectory/balanced.log") | $(grep 'Blocks balanced' "$sDirectory/balanced.log")"
+
+if cmp -s "$sDirectory/static.txt" "$sDirectory/balanced.txt"
+then
+	echo "The last generations are the same"
+else
+	echo "The last generations differ"
+	exit 1
+fi
@@ -0,0 +1,431 @@
+/*
+ *
+ * The Game of Life
+ *		- OpenMPI /w OpenMP ensembles | many independent runs in one job
+ *
+ * Rules of the game: Adapted from - http://codingdojo.org/kata/GameOfLife/
+ *
+ * Any live cell with fewer than two live neighbours dies, as if caused by underpopulation.
+ * Any live cell with more than three live neighbours dies, as if by overcrowding.
+ * Any live cell with two or three live neighbours lives on to the next generation.
+ * Any dead cell with exactly three live neighbours becomes a live cell.
+ *
+ * The runs are the lines of a manifest: input, rule, generations, output and boundary of every run (life_ensemble.h).
+ * The program starts once for all of them: the processes form groups of --group-size processes, every group takes
+ * the next unit of runs from a shared work queue as soon as it is done with the last one. A large grid (more than
+ * --small cells) is computed by all processes of its group as blocks with halos, as the hybrid program does. The
+ * small grids of a rule come in batches of --batch grids per process: every process packs its grids into one sheet,
+ * and every kernel call advances all of them at once.
+ *
+ * The outputs are written as the serial program writes them: text, a binary grid file (".bin") or an RLE pattern (".rle").
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <stdlib.h>
+#include <mpi.h>
+#include <omp.h>
+
+// Including the bit-packed grid, its kernel, its boundaries, the decomposition, the halo exchange, the parallel input and output, the binary grid file, the RLE pattern file, the ensembles and the schedule of the threads
+#include "life_grid.h"
+#include "life_kernel.h"
+#include "life_bounds.h"
+#include "life_domain.h"
+#include "life_halo.h"
+#include "life_io.h"
+#include "life_file.h"
+#include "life_rle.h"
+#include "life_ensemble.h"
+#include "life_schedule.h"
+
+using namespace std;
+
+// Print the arguments of the program
+void printUsage()
+{
+	printf("Usuage: mpirun -np <# processes> ./<executable> <manifest_file> <# threads>"
+		   " [--group-size <processes>] [--batch <grids>] [--small <cells>] [--schedule static|dynamic|guided[,<chunk>]] [--tile <rows>x<columns>]\n");
+}
+
+// Set the kernels to the rule of a job. Returns the radius of its neighbourhood.
+int setJobRule(const LifeJob &job)
+{
+	LifeRule rule;
+	createRule(rule);
+	parseRule(rule, job.sRule);
+	setKernelRule(rule);
+	return rule.iRadius;
+}
+
+// Write the last generation of a board of the sheet
+int writeBoard(const LifeJob &job, const LifeSheet &sheet, const LifeBoard &board)
+{
+	LifeGrid gridBoard;
+	copyBoard(gridBoard, sheet, board);
+	int iWritten = writeJobGrid(job, gridBoard, sheet.iDepth);
+	freeGrid(gridBoard);
+
+	if(!iWritten)
+		cout << "Error writing " << job.sOutput << endl;
+	return iWritten;
+}
+
+// Compute the small jobs iJobs[0] .. iJobs[iBoardCount - 1] of one rule together: their grids are the boards of a sheet,
+// every kernel call computes all of them, and every board is written once it reaches its last generation.
+// Returns the number of jobs written.
+int runSheet(const LifeJob *jobs, const int *iJobs, int iBoardCount, int thread_count, const LifeSchedule &schedule)
+{
+	int iDepth = setJobRule(jobs[iJobs[0]]);
+
+	LifeSheet sheet;
+	packSheet(sheet, jobs, iJobs, iBoardCount, iDepth);
+
+	// A board which can not be read stays dead and is not written
+	int *iValid = (int *) malloc(iBoardCount * sizeof(int));
+	int iGenerations = 0, iWritten = 0;
+	for(int b = 0; b < iBoardCount; b++)
+	{
+		const LifeBoard &board = sheet.boards[b];
+		const LifeJob &job = jobs[board.iJob];
+		iValid[b] = readJobCells(job, sheet.grid, board.iRow + iDepth, board.iColumn + iDepth);
+		if(!iValid[b])
+		{
+			cout << "Job " << job.sInput << " -> " << job.sOutput << " failed" << endl;
+			continue;
+		}
+
+		addBoardLayers(sheet.grid, board, iDepth);
+		if(job.iGenerations > iGenerations)
+			iGenerations = job.iGenerations;
+		if(job.iGenerations == 0)
+			iWritten += writeBoard(job, sheet, board);
+	}
+
+	// One team of threads runs through the generations of the longest job
+	#pragma omp parallel num_threads(thread_count)
+	for(int iSteps = 1; iSteps <= iGenerations; iSteps++)
+	{
+		// All rows of all shelves at once: the kernel does not know where a board ends
+		nextGenerationScheduled(schedule, sheet.grid, sheet.gridNew, iDepth, sheet.grid.iRowCount - iDepth, 0, sheet.grid.iWordCount, NULL);
+		#pragma omp barrier
+
+		// The layers of the boards, shelf by shelf: the boards of a shelf share the words of their rows
+		#pragma omp for schedule(dynamic)
+		for(int s = 0; s < sheet.iShelfCount; s++)
+			for(int b = sheet.iShelfStarts[s]; b < sheet.iShelfStarts[s + 1]; b++)
+				addBoardLayers(sheet.gridNew, sheet.boards[b], iDepth);
+
+		#pragma omp single
+		{
+			swapGrids(sheet.grid, sheet.gridNew);
+			for(int b = 0; b < iBoardCount; b++)
+				if(iValid[b] && jobs[sheet.boards[b].iJob].iGenerations == iSteps)
+					iWritten += writeBoard(jobs[sheet.boards[b].iJob], sheet, sheet.boards[b]);
+		}
+	}
+
+	free(iValid);
+	freeSheet(sheet);
+	return iWritten;
+}
+
+// Compute the large job iJob on all processes of the group, every one of them a block with halos as deep as the neighbourhood.
+// Collective over the group. Returns 1 if the last generation has been written.
+int runLargeJob(const LifeJob *jobs, int iJob, MPI_Comm groupComm, int thread_count, const LifeSchedule &schedule)
+{
+	const LifeJob &job = jobs[iJob];
+	int iRadius = setJobRule(job), iGroupRank;
+	MPI_Comm_rank(groupComm, &iGroupRank);
+
+	// A grid which can not be cut into blocks of iRadius rows and columns for the group is computed by its first process alone
+	LifeDomain domain;
+	if(!createDomain(domain, groupComm, job.iRowCount, job.iColumnCount, iRadius, job.boundary == LIFE_BOUNDARY_TORUS))
+	{
+		int iWritten = 0;
+		if(iGroupRank == 0)
+			iWritten = runSheet(jobs, &iJob, 1, thread_count, schedule);
+		MPI_Bcast(&iWritten, 1, MPI_INT, 0, groupComm);
+		return iWritten;
+	}
+
+	LifeGrid grid, gridNew;
+	allocateGrid(grid, domain.iRowCount + 2 * iRadius, domain.iColumnCount + 2 * iRadius);
+	allocateGrid(gridNew, domain.iRowCount + 2 * iRadius, domain.iColumnCount + 2 * iRadius);
+
+	// Every process reads its own block: from the mapping of a binary grid file, from the runs of an RLE pattern,
+	// from its rows of a fixed-width text (all processes at once), or going through any other text
+	int iValid = 1;
+	if(isLifeFile(job.sInput))
+	{
+		LifeFile file;
+		iValid = openLifeFile(file, job.sInput);
+		if(iValid)
+		{
+			iValid = readBlockFile(file, domain, grid);
+			closeLifeFile(file);
+		}
+	}
+	else if(isRleFile(job.sInput))
+	{
+		LifeRle rle;
+		iValid = openRle(rle, job.sInput);
+		if(iValid)
+		{
+			iValid = readRleCells(rle, grid, iRadius, iRadius, domain.iRowStart - 1, domain.iRowCount, domain.iColumnStart - 1, domain.iColumnCount);
+			closeRle(rle);
+		}
+	}
+	else
+	{
+		MPI_File fileInput;
+		MPI_File_open(domain.cartComm, job.sInput, MPI_MODE_RDONLY, MPI_INFO_NULL, &fileInput);
+		if(isFixedWidthInput(fileInput, job.lHeaderSize, job.iRowCount, job.iColumnCount))
+			readBlock(fileInput, job.lHeaderSize, job.iRowCount, job.iColumnCount, domain, grid);
+		else
+			iValid = readTextCells(job.sInput, grid, iRadius, iRadius, domain.iRowStart - 1, domain.iRowCount, domain.iColumnStart - 1, domain.iColumnCount);
+		MPI_File_close(&fileInput);
+	}
+
+	MPI_Allreduce(MPI_IN_PLACE, &iValid, 1, MPI_INT, MPI_MIN, domain.cartComm);
+	if(iValid)
+	{
+		copyGrid(gridNew, grid);
+
+		// Buffers and persistent requests of the halo exchange with the eight neighbours are set up once
+		LifeHalo halo;
+		createHalo(halo, grid, gridNew, domain);
+
+		// One team of threads runs through all generations, the master thread alone exchanges the halos
+		#pragma omp parallel num_threads(thread_count)
+		for(int iSteps = 1; iSteps <= job.iGenerations; iSteps++)
+		{
+			#pragma omp master
+			{
+				startHalo(halo, grid);
+				finishHalo(halo, grid);
+			}
+			#pragma omp barrier
+
+			nextGenerationScheduled(schedule, grid, gridNew, iRadius, grid.iRowCount - iRadius, 0, grid.iWordCount, NULL);
+			#pragma omp barrier
+
+			// The new generated state becomes the reference to create the newer one
+			#pragma omp single
+			swapGrids(grid, gridNew);
+		}
+		freeHalo(halo);
+
+		// Only the runs of live cells of an RLE pattern go to the first process of the group, which writes the pattern
+		if(isRleOutput(job.sOutput))
+		{
+			LifeRule rule;
+			createRule(rule);
+			parseRule(rule, job.sRule);
+
+			long lRunCount;
+			LifeRun *runs = gatherRuns(domain, grid, lRunCount);
+			if(iGroupRank == 0)
+			{
+				iValid = writeRleRuns(job.sOutput, runs, lRunCount, job.iRowCount, job.iColumnCount, rule, job.uGeneration + job.iGenerations,
+									  job.lRowOrigin, job.lColumnOrigin);
+				free(runs);
+			}
+		}
+		else
+		{
+			// All processes of the group write their own blocks at once
+			MPI_File fileOutput;
+			MPI_File_open(domain.cartComm, job.sOutput, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fileOutput);
+			MPI_File_set_size(fileOutput, 0);
+
+			if(isBinaryOutput(job.sOutput))
+				writeBlockBinary(fileOutput, job.iRowCount, job.iColumnCount, job.uGeneration + job.iGenerations, domain, grid);
+			else
+				writeBlock(fileOutput, job.iRowCount, job.iColumnCount, domain, grid);
+
+			MPI_File_close(&fileOutput);
+		}
+		MPI_Bcast(&iValid, 1, MPI_INT, 0, domain.cartComm);
+	}
+
+	if(!iValid && iGroupRank == 0)
+		cout << "Job " << job.sInput << " -> " << job.sOutput << " failed" << endl;
+
+	freeDomain(domain);
+	freeGrid(grid);
+	freeGrid(gridNew);
+	return iValid;
+}
+
+// Main function
+int main(int argc, char *argv[])
+{
+	// Checking the number of input has to be passed by the user
+	if (argc < 3)
+	{
+		printUsage();
+		return -1;
+	}
+
+	// Optional arguments: the groups, the batches of small grids and the schedule of the threads
+	int iGroupSize = 1, iBatch = LIFE_ENSEMBLE_BATCH;
+	long long lSmallCells = LIFE_ENSEMBLE_SMALL_CELLS;
+	LifeSchedule schedule;
+	createSchedule(schedule);
+	for(int i = 3; i < argc; i++)
+	{
+		string sOption = argv[i];
+		if(sOption == "--group-size" && i + 1 < argc && atoi(argv[i + 1]) > 0)
+			iGroupSize = atoi(argv[++i]);
+		else if(sOption == "--batch" && i + 1 < argc && atoi(argv[i + 1]) > 0)
+			iBatch = atoi(argv[++i]);
+		else if(sOption == "--small" && i + 1 < argc && atoll(argv[i + 1]) >= 0)
+			lSmallCells = atoll(argv[++i]);
+		else if(sOption == "--schedule" && i + 1 < argc && parseSchedule(schedule, argv[i + 1]))
+			i++;
+		else if(sOption == "--tile" && i + 1 < argc && parseTile(schedule, argv[i + 1]))
+			i++;
+		else
+		{
+			printUsage();
+			return -1;
+		}
+	}
+
+	int thread_count = atoi(argv[2]);
+
+	// Initialize the MPI environment: only the master thread of the team calls MPI
+	int iThreadSupport;
+	MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &iThreadSupport);
+
+	// Get the number of processes
+	int world_size, world_rank;
+	MPI_Comm_size(MPI_COMM_WORLD, &world_size); // Total number of processes
+	MPI_Comm_rank(MPI_COMM_WORLD, &world_rank); // Rank of processes starting from 0 till (world_size - 1)
+
+	if(iThreadSupport < MPI_THREAD_FUNNELED && world_rank == 0)
+		cout << "The MPI library does not support calls from the master thread of a team (MPI_THREAD_FUNNELED)" << endl;
+
+	// Execution time calculation variables
+	double dStartTime = MPI_Wtime(), dEndTime;
+
+	// Process 0 reads the manifest and the headers of the inputs, all processes get the jobs
+	LifeJob *jobs = NULL;
+	int iJobCount = 0;
+	if(world_rank == 0)
+	{
+		iJobCount = readManifest(argv[1], jobs);
+		for(int k = 0; k < iJobCount; k++)
+			readJobHeader(jobs[k]);
+	}
+	MPI_Bcast(&iJobCount, 1, MPI_INT, 0, MPI_COMM_WORLD);
+	if(iJobCount < 0)
+	{
+		MPI_Finalize();
+		return -1;
+	}
+	if(world_rank != 0)
+		jobs = (LifeJob *) malloc((iJobCount + 1) * sizeof(LifeJob));
+	MPI_Bcast(jobs, iJobCount * (int) sizeof(LifeJob), MPI_BYTE, 0, MPI_COMM_WORLD);
+
+	// Groups of iGroupSize neighbouring ranks (the last one may be smaller)
+	if(iGroupSize > world_size)
+		iGroupSize = world_size;
+	MPI_Comm groupComm;
+	int iGroup = world_rank / iGroupSize, group_size, group_rank;
+	MPI_Comm_split(MPI_COMM_WORLD, iGroup, world_rank, &groupComm);
+	MPI_Comm_size(groupComm, &group_size);
+	MPI_Comm_rank(groupComm, &group_rank);
+
+	// Every process cuts the jobs into the same units, a batch holds iBatch small grids for every process of a group
+	int *iOrder;
+	LifeUnit *units;
+	int iUnitCount = planUnits(jobs, iJobCount, lSmallCells, iBatch * iGroupSize, iOrder, units);
+
+	// The threads share the tiles of the rows by the schedule of the command line
+	applySchedule(schedule);
+
+	// The groups take the units from the queue until there are none left
+	LifeQueue queue;
+	createQueue(queue, groupComm);
+
+	long lJobsWritten = 0;
+	double dCellGenerations = 0;
+	int *iBoardJobs = (int *) malloc((iBatch * iGroupSize + 1) * sizeof(int));
+	for(int iUnit = takeUnit(queue); iUnit < iUnitCount; iUnit = takeUnit(queue))
+	{
+		const LifeUnit &unit = units[iUnit];
+
+		if(unit.iLarge)
+		{
+			const LifeJob &job = jobs[iOrder[unit.iFirst]];
+			int iWritten = runLargeJob(jobs, iOrder[unit.iFirst], groupComm, thread_count, schedule);
+			if(group_rank == 0)
+			{
+				lJobsWritten += iWritten;
+				cout << "Group " << iGroup << " | Job " << job.sInput << " -> " << job.sOutput << " | Grid Size: " << job.iRowCount << " * " << job.iColumnCount
+					 << " | Generations: " << job.iGenerations << " on " << group_size << " processes" << endl;
+			}
+			dCellGenerations += (double) job.iRowCount * job.iColumnCount * job.iGenerations / group_size;
+			continue;
+		}
+
+		// The processes of the group share the batch: every group_size-th grid is for this process
+		int iBoardCount = 0;
+		for(int k = group_rank; k < unit.iCount; k += group_size)
+		{
+			const LifeJob &job = jobs[iOrder[unit.iFirst + k]];
+			iBoardJobs[iBoardCount++] = iOrder[unit.iFirst + k];
+			dCellGenerations += (double) job.iRowCount * job.iColumnCount * job.iGenerations;
+		}
+
+		if(iBoardCount > 0)
+		{
+			lJobsWritten += runSheet(jobs, iBoardJobs, iBoardCount, thread_count, schedule);
+			cout << "Process " << world_rank << " | Group " << iGroup << " | Batch of " << iBoardCount << " grids | Rule: " << jobs[iBoardJobs[0]].sRule << endl;
+		}
+	}
+	free(iBoardJobs);
+	freeQueue(queue);
+
+	// The jobs written and the cells computed by all processes
+	long lJobsSum;
+	double dCellGenerationsSum;
+	MPI_Reduce(&lJobsWritten, &lJobsSum, 1, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+	MPI_Reduce(&dCellGenerations, &dCellGenerationsSum, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+	if(world_rank == 0)
+	{
+		int iValidCount = 0;
+		for(int k = 0; k < iJobCount; k++)
+			iValidCount += jobs[k].iValid;
+
+		// Measure the ending clock time
+		dEndTime = MPI_Wtime();
+
+		// Calculate the time of the program
+		cout << "Execution time: " << dEndTime - dStartTime << endl;
+
+		cout << "\n\nProgram Configuration" << endl;
+		cout << "Jobs: " << iJobCount << " (" << iJobCount - iValidCount << " not valid) in " << iUnitCount << " units | Written: " << lJobsSum << endl;
+		cout << "Processes: " << world_size << " in groups of " << iGroupSize << " | Threads: " << thread_count << endl;
+		cout << "Batch: " << iBatch << " grids per process | Small grids: up to " << lSmallCells << " cells" << endl;
+		cout << "Kernel: " << getRowKernelName() << " | Schedule: " << getScheduleName(schedule) << " of " << schedule.iTileRows << " * " << schedule.iTileWords * LIFE_WORD_BITS << " tiles" << endl;
+		cout << "Cell updates per second: " << dCellGenerationsSum / (dEndTime - dStartTime) << endl;
+	}
+
+	// Free the units, the jobs and the groups
+	free(iOrder);
+	free(units);
+	free(jobs);
+	MPI_Comm_free(&groupComm);
+
+	// Finalize the MPI environment.
+	MPI_Finalize();
+
+	return 0;
+}
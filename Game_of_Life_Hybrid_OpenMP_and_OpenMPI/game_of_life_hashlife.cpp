@@ -0,0 +1,329 @@
+/*
+ *
+ * The Game of Life
+ *		- a HashLife implementation for huge grids and many generations
+ *
+ * Rules of the game: Adapted from - http://codingdojo.org/kata/GameOfLife/
+ *
+ * Any live cell with fewer than two live neighbours dies, as if caused by underpopulation.
+ * Any live cell with more than three live neighbours dies, as if by overcrowding.
+ * Any live cell with two or three live neighbours lives on to the next generation.
+ * Any dead cell with exactly three live neighbours becomes a live cell.
+ *
+ * Any other Life-like rule is given with --rule in B/S notation or by its name (life_rule.h).
+ *
+ * The input may be an RLE pattern (life_rle.h), which brings its rule along unless --rule is given;
+ * the last generation is written as one when the name of the output ends in ".rle".
+ *
+ * The grid wraps around as a torus unless --boundary grow puts the pattern on the unbounded plane.
+ * The input goes straight into the leaves of the quadtree and the output is written from it, so
+ * no dense copy of the grid is made.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+// Including the bit-packed grid, its kernel, the binary grid file, the boundaries and the HashLife engine
+#include "life_grid.h"
+#include "life_kernel.h"
+#include "life_file.h"
+#include "life_bounds.h"
+#include "life_hashlife.h"
+#include "life_rle.h"
+
+using namespace std;
+
+// Add a run of live cells of the RLE pattern to the leaves
+static void addRleRun(void *pState, int iRow, int iColumn, int iCount)
+{
+	addRun(*(LifeLeaves *) pState, iRow, iColumn, iCount);
+}
+
+// Write iRowCount * iColumnCount cells of the root from its cell (lRowStart, lColumnStart) on as a binary grid file, the rows
+// of eight at a time taken from the tree
+static void writeRootFile(const char *sFileName, LifeHashLife &life, long long lRowStart, long long lColumnStart, int iRowCount,
+						  int iColumnCount, uint64_t uGeneration)
+{
+	FILE *pFile = fopen(sFileName, "wb");
+	if(!pFile)
+		return;
+
+	LifeFileHeader header;
+	initHeader(header, iRowCount, iColumnCount, uGeneration);
+
+	// The header is written again with the checksum at the end
+	unsigned char cHeader[sizeof(LifeFileHeader)];
+	storeHeader(header, cHeader);
+	fwrite(cHeader, 1, sizeof(cHeader), pFile);
+
+	LifeGrid band;
+	allocateGrid(band, 8, iColumnCount);
+	size_t iRowBytes = lifeRowBytes(iColumnCount);
+	unsigned char *cRow = (unsigned char *) malloc(iRowBytes);
+	for(int i = 0; i < iRowCount; i++)
+	{
+		if(i % 8 == 0)
+			extractBand(life, life.root, band, lRowStart + i, lColumnStart);
+		packRow(band, i % 8, 0, iColumnCount, cRow);
+		header.uChecksum += checksumRow(cRow, iRowBytes, (uint64_t) i);
+		fwrite(cRow, 1, iRowBytes, pFile);
+	}
+	free(cRow);
+	freeGrid(band);
+
+	fseek(pFile, 0, SEEK_SET);
+	storeHeader(header, cHeader);
+	fwrite(cHeader, 1, sizeof(cHeader), pFile);
+	fclose(pFile);
+}
+
+// Main function
+int main(int argc, char *argv[])
+{
+	// Checking the number of input has to be passed by the user
+	if (argc < 4)
+    {
+        printf("Usuage: ./<executable> <input_file> <iterations> <output_file> [--memory <MB>] [--rule B<counts>/S<counts>|<name>] [--boundary torus|grow]\n");
+        return -1;
+    }
+
+    // Optional arguments: the memory of the nodes, the rule of the game and the boundary (no dead edges)
+    size_t iMemory = 1024;
+    int iRuleGiven = 0;
+    LifeRule rule;
+    createRule(rule);
+    LifeBoundary boundary = LIFE_BOUNDARY_TORUS;
+    for(int i = 4; i < argc; i++)
+    {
+    	if(strcmp(argv[i], "--memory") == 0 && i + 1 < argc)
+    		iMemory = (size_t) atol(argv[++i]);
+    	else if(strcmp(argv[i], "--rule") == 0 && i + 1 < argc && parseRule(rule, argv[i + 1]))
+    	{
+    		i++;
+    		iRuleGiven = 1;
+    	}
+    	else if(strcmp(argv[i], "--boundary") == 0 && i + 1 < argc && parseBoundary(boundary, argv[i + 1]) && boundary != LIFE_BOUNDARY_DEAD)
+    		i++;
+    	else
+    	{
+    		printf("Usuage: ./<executable> <input_file> <iterations> <output_file> [--memory <MB>] [--rule B<counts>/S<counts>|<name>] [--boundary torus|grow]\n");
+    		return -1;
+    	}
+    }
+
+    // An RLE pattern brings its rule along
+    LifeRle rle;
+    int iRleInput = isRleFile(argv[1]);
+    if(iRleInput)
+    {
+    	if(!openRle(rle, argv[1]))
+    		return -1;
+    	if(!iRuleGiven && rle.sRule[0] && !parseRule(rule, rle.sRule))
+    	{
+    		printf("The rule %s of the input file is not supported.\n", rle.sRule);
+    		return -1;
+    	}
+    }
+    setKernelRule(rule);
+
+    // The leaves hold 8 * 8 cells and are computed by the kernels of the eight neighbours
+    if(isLargerThanLife(rule))
+    {
+    	printf("HashLife runs the rules of the eight neighbours only.\n");
+    	return -1;
+    }
+
+    // Getting values from the argument: the generations may go far beyond the ones of the other programs
+    ifstream fInput(argv[1]);
+    uint64_t uGenerations = strtoull(argv[2], NULL, 10);
+
+    // Checking whether the input file exists in the directory or not
+    if (!fInput)
+	{
+		printf("Error opening the input file.\n");
+		return -1;
+	}
+
+	// Initializing necessary variables
+	int iRowCount, iColumnCount;
+	char cItem;
+	uint64_t uGeneration = 0;
+	long long lRowOrigin = 0, lColumnOrigin = 0;
+
+	// The live cells are gathered as the leaves of the quadtree
+	LifeLeaves leaves;
+	createLeaves(leaves);
+
+	// A binary grid file gives its leaves straight from its memory mapping, eight rows at a time
+	if(isLifeFile(argv[1]))
+	{
+		LifeFile fileGrid;
+		if(!openLifeFile(fileGrid, argv[1]))
+			return -1;
+
+		iRowCount = (int) fileGrid.header.uRowCount;
+		iColumnCount = (int) fileGrid.header.uColumnCount;
+		uGeneration = fileGrid.header.uGeneration;
+
+		if(checksumRows(fileGrid, 0, iRowCount) != fileGrid.header.uChecksum)
+		{
+			printf("The checksum of the input file does not match its grid.\n");
+			return -1;
+		}
+
+		// A byte of a row is a row of a leaf, the padding behind the last column is left out
+		size_t iRowBytes = lifeRowBytes(iColumnCount);
+		uint64_t *uBand = (uint64_t *) calloc(iRowBytes, sizeof(uint64_t));
+		unsigned char cLastByte = (iColumnCount % 8) ? (unsigned char) ((1 << (iColumnCount % 8)) - 1) : 0xff;
+		for(int i = 0; i < iRowCount; i++)
+		{
+			const unsigned char *cRow = fileGrid.cRows + (size_t) i * iRowBytes;
+			for(size_t k = 0; k < iRowBytes; k++)
+				uBand[k] |= (uint64_t) (cRow[k] & ((k + 1 < iRowBytes) ? 0xff : cLastByte)) << (8 * (i % 8));
+			if(i % 8 == 7 || i + 1 == iRowCount)
+				addBand(leaves, i / 8, uBand, (long long) iRowBytes);
+		}
+		free(uBand);
+		closeLifeFile(fileGrid);
+	}
+	else if(iRleInput)
+	{
+		// The runs of an RLE pattern go straight into the leaves
+		iRowCount = rle.iRowCount;
+		iColumnCount = rle.iColumnCount;
+		uGeneration = rle.uGeneration;
+		lRowOrigin = rle.lRowOrigin;
+		lColumnOrigin = rle.lColumnOrigin;
+
+		if(!scanRuns(rle, addRleRun, &leaves))
+		{
+			printf("The runs of the RLE pattern are broken.\n");
+			return -1;
+		}
+		closeRle(rle);
+	}
+	else
+	{
+		// Getting the grid dimension from the first line of the input file
+		fInput >> iRowCount >> iColumnCount;
+
+		// Populating the leaves from file, a band of eight rows at a time
+		long long lLeafCount = ((long long) iColumnCount + 7) / 8;
+		uint64_t *uBand = (uint64_t *) calloc(lLeafCount, sizeof(uint64_t));
+		int iCounterRow = 0, iCounterColumn = 0;
+		while(iCounterRow < iRowCount && fInput >> cItem)
+		{
+			if(cItem != '0')
+				uBand[iCounterColumn / 8] |= (uint64_t) 1 << (8 * (iCounterRow % 8) + iCounterColumn % 8);
+
+			// Condition to always maintain the correct index order of the 2D array
+			if(++iCounterColumn == iColumnCount)
+			{
+				iCounterColumn = 0;
+				if(++iCounterRow % 8 == 0)
+					addBand(leaves, iCounterRow / 8 - 1, uBand, lLeafCount);
+			}
+		}
+		addBand(leaves, iCounterRow / 8, uBand, lLeafCount);
+		free(uBand);
+	}
+
+	// Done reading from the file
+	fInput.close();
+
+	// The leaves become the root of the quadtree, on the torus dead beyond its rows and columns
+	LifeHashLife life;
+	createHashLife(life, iMemory << 20);
+	life.root = buildPattern(life, leaves, patternLevel(iRowCount, iColumnCount));
+	life.lRowOrigin = lRowOrigin;
+	life.lColumnOrigin = lColumnOrigin;
+
+	// All set for the game: the pattern is advanced by all generations at once
+	clock_t tStart = clock();
+
+	if(boundary == LIFE_BOUNDARY_GROW)
+		advancePlane(life, uGenerations);
+	else
+		advanceTorus(life, iRowCount, iColumnCount, uGenerations);
+
+	double dTime = (double) (clock() - tStart) / CLOCKS_PER_SEC;
+
+	// The cells written: the torus, or the live cells on the plane (a single dead cell if there are none)
+	long long lBounds[4] = { 0, iRowCount, 0, iColumnCount };
+	if(boundary == LIFE_BOUNDARY_GROW)
+	{
+		if(!findNodeBounds(life, life.root, lBounds))
+		{
+			lBounds[0] = lBounds[2] = 0;
+			lBounds[1] = lBounds[3] = 1;
+		}
+		if(lBounds[1] - lBounds[0] > INT_MAX || lBounds[3] - lBounds[2] > INT_MAX)
+		{
+			printf("The live cells spread over more rows or columns than a grid file holds.\n");
+			return -1;
+		}
+
+		iRowCount = (int) (lBounds[1] - lBounds[0]);
+		iColumnCount = (int) (lBounds[3] - lBounds[2]);
+		lRowOrigin = life.lRowOrigin + lBounds[0];
+		lColumnOrigin = life.lColumnOrigin + lBounds[2];
+	}
+
+	// Write the final state to the binary grid file (a file name ending in ".bin"), as an RLE pattern (".rle") or as text
+	size_t iNameLength = strlen(argv[3]);
+	if(iNameLength >= 4 && strcmp(argv[3] + iNameLength - 4, ".bin") == 0)
+		writeRootFile(argv[3], life, lBounds[0], lBounds[2], iRowCount, iColumnCount, uGeneration + uGenerations);
+	else if(isRleOutput(argv[3]))
+	{
+		LifeRun *runs;
+		long lRunCount = findNodeRuns(life, life.root, lBounds[0], lBounds[2], runs);
+		writeRleRuns(argv[3], runs, lRunCount, iRowCount, iColumnCount, rule, uGeneration + uGenerations, lRowOrigin, lColumnOrigin);
+		free(runs);
+	}
+	else
+	{
+		// The rows of eight at a time are taken from the tree
+		LifeGrid band;
+		allocateGrid(band, 8, iColumnCount);
+		ofstream fOutput(argv[3]);
+		for(int i = 0; i < iRowCount; i++)
+		{
+			if(i % 8 == 0)
+				extractBand(life, life.root, band, lBounds[0] + i, lBounds[2]);
+			for (int j = 0; j < iColumnCount; j++)
+				fOutput << getCell(band, i % 8, j) << " ";
+
+			fOutput << endl;
+		}
+
+		// Done writing to the file
+		fOutput.close();
+		freeGrid(band);
+	}
+
+	cout << "Execution time: " << dTime << endl;
+	cout << "\n\nProgram Configuration" << endl;
+	cout << "Grid Size: " << iRowCount << " * " << iColumnCount << endl;
+	cout << "Number of generations: " << uGenerations << endl;
+	cout << "Boundary: " << getBoundaryName(boundary) << endl;
+	if(boundary == LIFE_BOUNDARY_GROW)
+		cout << "Window: rows " << lRowOrigin << " .. " << lRowOrigin + iRowCount - 1 << ", columns "
+			 << lColumnOrigin << " .. " << lColumnOrigin + iColumnCount - 1 << endl;
+	cout << "Nodes: " << life.iNodeCount << " | Garbage collections: " << life.lCollections << endl;
+	cout << "Last generation output has been written to file." << endl;
+
+	// Free the nodes
+	freeHashLife(life);
+
+	return 0;
+}
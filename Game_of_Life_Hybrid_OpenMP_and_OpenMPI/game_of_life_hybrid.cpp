@@ -10,8 +10,24 @@
  * Any live cell with two or three live neighbours lives on to the next generation.
  * Any dead cell with exactly three live neighbours becomes a live cell.
  *
+ * Any other Life-like rule is given with --rule in B/S notation or by its name (life_rule.h).
+ *
+ * The grid wraps around as a torus unless --boundary dead makes its edges dead (life_bounds.h):
+ * the blocks along the edges then exchange no halos across them.
+ *
+ * With --snapshot every iSnapshotEvery-th generation is gathered on process 0 and goes to a snapshot
+ * stream, encoded and written in the background while the next generations are computed (life_stream.h).
+ *
+ * An RLE pattern (life_rle.h) is read by every process, keeping the live cells of its own block, and brings
+ * its rule along unless --rule is given. An output ending in ".rle" gathers the runs of live cells on process 0.
+ *
+ * With --stats the threads count the cells they compute while they are in cache and the processes add up
+ * their blocks by one reduction per generation; process 0 writes the population, births, deaths, bounding
+ * box and hash of every generation. --stop-on-cycle ends the run at the first still life or oscillation
+ * of a period up to --cycle-period (life_stats.h). The generations are computed level by level then.
+ *
  * @author Md. Ahsan Ayub
- * @version 4.2 04/19/2019 
+ * @version 6.3 10/18/2026 
  *
  */
 
@@ -19,110 +35,89 @@
 #include <string>
 #include <fstream>
 #include <stdlib.h>
+#include <limits>
 #include <mpi.h>
 #include <omp.h>
 
+// Including the bit-packed grid, its kernel, its boundaries, the activity of its tiles, the decomposition, the halo exchange, the parallel input and output, the binary grid file, the checkpoints, the snapshot stream, the statistics, the load balancing, the schedule of the threads and their placement
+#include "life_grid.h"
+#include "life_activity.h"
+#include "life_kernel.h"
+#include "life_bounds.h"
+#include "life_domain.h"
+#include "life_halo.h"
+#include "life_io.h"
+#include "life_file.h"
+#include "life_checkpoint.h"
+#include "life_stream.h"
+#include "life_rle.h"
+#include "life_stats.h"
+#include "life_balance.h"
+#include "life_schedule.h"
+#include "life_placement.h"
+
 using namespace std;
 
 // Declaring global grid array
-int **iGrid;
-int **iGridNew;
+LifeGrid grid;
+LifeGrid gridNew;
 
 // Actial values will be initialized after knowing the user defined grid dimension
 int iActualRowCount = 0, iActualColumnCount = 0;
 
-// Allocate the arrays
+// Allocate the arrays, their pages are placed by the threads later on
 void allocateGrids(int iRowSize, int iColumnSize)
 {
-	iGrid = new int*[iRowSize];
-	iGridNew = new int*[iRowSize]; // A copy of iGrid
-	for (int i = 0; i < iRowSize; i++)
-	{
-		iGrid[i] = new int[iColumnSize];
-		iGridNew[i] = new int[iColumnSize];
-	}
-}
-
-// Add outer layers to the grid
-void addOuterLayers()
-{
-	// Add top layer which is the copy of the iRowCount th stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[0][i] = iGrid[iActualRowCount - 2][i];
-
-	// Add bottom layer which is the copy of the 1 st stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[iActualRowCount - 1][i] = iGrid[1][i];
-
-	// Add left layer which is the copy of the iColumnCount st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][0] = iGrid[i][iActualColumnCount - 2];
-
-	// Add right layer which is the copy of the 1 st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][iActualColumnCount-1] = iGrid[i][1];
-
-	// Diagonal copies
-	iGrid[0][0] = iGrid[iActualRowCount - 2][iActualColumnCount - 2];	// Upper Left
-	iGrid[0][iActualColumnCount - 1] = iGrid[iActualRowCount - 2][1];	// Upper Right
-	iGrid[iActualRowCount - 1][0] = iGrid[1][iActualColumnCount - 2];	// Lower Left
-	iGrid[iActualRowCount - 1][iActualColumnCount - 1] = iGrid[1][1];	// Lower Right
+	allocateGridUntouched(grid, iRowSize, iColumnSize);
+	allocateGridUntouched(gridNew, iRowSize, iColumnSize); // A copy of grid
 }
 
-// Print routine of iGrid
+// Print routine of grid
 void printGrid(int iRowCountStart, int iRowCountEnd, int iColumnCountStart, int iColumnCountEnd)
 {
 	for(int i = iRowCountStart; i < iRowCountEnd; i++)
 	{
 		for(int j = iColumnCountStart; j < iColumnCountEnd; j++)
-			cout << iGrid[i][j] << " ";
+			cout << getCell(grid, i, j) << " ";
 		cout << endl;
 	}
 }
 
-// Copy routine to iGrid from iGridNew (to make a new state's copy)
-void copyGrid(int iRowCount, int iColumnCount)
+// Print the arguments of the program
+void printUsage()
 {
-	for(int i = 0; i < iRowCount; i++)
-		for(int j = 0; j < iColumnCount; j++)
-			iGrid[i][j] = iGridNew[i][j];
+	printf("Usuage: mpirun -np <# processes> ./<executable> <input_file> <# threads> <iterations> <output_file>"
+		   " [--rule B<counts>/S<counts>|<name>] [--boundary torus|dead] [--halo-depth <rows>] [--sparse] [--balance <generations>] [--schedule static|dynamic|guided[,<chunk>]] [--tile <rows>x<columns>] [--checkpoint <file> [--checkpoint-every <generations>] [--checkpoint-seconds <seconds>] [--restart]] [--snapshot <file> [--snapshot-every <generations>]]"
+		   " [--stats <file>] [--cycle-period <generations>] [--stop-on-cycle]\n");
 }
 
-// Measure the neighbors' status of a particular cell
-int adjacentNeighbors(int i, int j)
+// Count the cells of the block of the grid (without its halos) as the generation uGeneration. The cell (0, 0) of the
+// input is the cell (lRowOrigin, lColumnOrigin) of the plane.
+void createBlockStats(LifeStats &stats, const LifeDomain &domain, int iHaloCells, long long lRowOrigin, long long lColumnOrigin,
+					  int thread_count, uint64_t uGeneration)
 {
-	// Variables to calculate the number of alive and dead cells
-	int iAliveCount = 0, iDeadCount = 0;
-
-	iGrid[i - 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-
-	if(iAliveCount < 2)
-		// A cell dies of loneliness
-		return 0;
-
-	else if(iAliveCount > 3)
-		// A cell dies of overcrowding
-		return 0;
-
-	else if(iGrid[i][j] == 1 && (iAliveCount == 2 || iAliveCount == 3))
-		// Current cell is alive, and there are TWO (which will become three in total) and exactly THREE cells alive.
-		// Thus, the cell survives.s
-		return 1;
-
-	else if(iGrid[i][j] == 0 && iAliveCount == 3)
-		// Current cell is NOT alive; however, there are exactly THREE alive cells: thus, the cell is born.
-		return 1;
-	
-	else
-		// Very unlikely this will be executed
-		return 0;
+	createStats(stats, grid, iHaloCells, iHaloCells + domain.iRowCount, iHaloCells, iHaloCells + domain.iColumnCount,
+				lRowOrigin + domain.iRowStart - 1 - iHaloCells, lColumnOrigin + domain.iColumnStart - 1 - iHaloCells, thread_count, uGeneration);
+}
+
+// Sum the statistics of the blocks (the operation of the reduction)
+void combineGenerationsOp(void *pIn, void *pInOut, int *iLength, MPI_Datatype * /* type */)
+{
+	LifeGeneration *in = (LifeGeneration *) pIn, *inOut = (LifeGeneration *) pInOut;
+	for(int k = 0; k < *iLength; k++)
+		combineGenerations(inOut[k], in[k]);
+}
+
+// The threads are done with a generation of the block, held by gridNew: the master thread sums their counts, all blocks
+// are summed by one reduction and process 0 writes the line of the generation. Returns 1 if it closes a cycle.
+int countGeneration(LifeStats &stats, const LifeGrid &gridNew, LifeGeneration &generation, LifeCycle &cycle, FILE *pStats,
+					MPI_Datatype generationType, MPI_Op combineOp)
+{
+	finishStats(stats, gridNew);
+	MPI_Allreduce(&stats.generation, &generation, 1, generationType, combineOp, MPI_COMM_WORLD);
+	if(pStats)
+		writeGeneration(pStats, generation);
+	return findCycle(cycle, generation) != 0;
 }
 
 // Add an outer layer of the whole array for the simplicity
@@ -131,17 +126,112 @@ int adjacentNeighbors(int i, int j)
 int main(int argc, char *argv[])
 {
 	// Checking the number of input has to be passed by the user
-	if (argc != 5)
+	if (argc < 5)
     {
-        printf("Usuage: mpirun -np <# processes> ./<executable> <input_file> <# threads> <iterations> <output_file>\n");
+        printUsage();
         return -1;
     }
 
+    // Optional arguments: the checkpoints of the run
+    const char *sCheckpointFile = NULL, *sSnapshotFile = NULL, *sStatsFile = NULL;
+    int iCheckpointEvery = 0, iSnapshotEvery = 1, iRestart = 0, iHaloDepth = 1, iSparse = 0, iBalanceEvery = 0, iRuleGiven = 0;
+    int iCyclePeriod = LIFE_CYCLE_PERIOD, iStopOnCycle = 0;
+    double dCheckpointSeconds = 0;
+    LifeSchedule schedule;
+    createSchedule(schedule);
+    LifeRule rule;
+    createRule(rule);
+    LifeBoundary boundary = LIFE_BOUNDARY_TORUS;
+    for(int i = 5; i < argc; i++)
+    {
+    	string sOption = argv[i];
+    	if(sOption == "--checkpoint" && i + 1 < argc)
+    		sCheckpointFile = argv[++i];
+    	else if(sOption == "--checkpoint-every" && i + 1 < argc)
+    		iCheckpointEvery = atoi(argv[++i]);
+    	else if(sOption == "--checkpoint-seconds" && i + 1 < argc)
+    		dCheckpointSeconds = atof(argv[++i]);
+    	else if(sOption == "--snapshot" && i + 1 < argc)
+    		sSnapshotFile = argv[++i];
+    	else if(sOption == "--snapshot-every" && i + 1 < argc && atoi(argv[i + 1]) > 0)
+    		iSnapshotEvery = atoi(argv[++i]);
+    	else if(sOption == "--restart")
+    		iRestart = 1;
+    	else if(sOption == "--rule" && i + 1 < argc && parseRule(rule, argv[i + 1]))
+    	{
+    		i++;
+    		iRuleGiven = 1;
+    	}
+    	else if(sOption == "--boundary" && i + 1 < argc && parseBoundary(boundary, argv[i + 1]))
+    		i++;
+    	else if(sOption == "--halo-depth" && i + 1 < argc)
+    		iHaloDepth = atoi(argv[++i]);
+    	else if(sOption == "--sparse")
+    		iSparse = 1;
+    	else if(sOption == "--balance" && i + 1 < argc)
+    		iBalanceEvery = atoi(argv[++i]);
+    	else if(sOption == "--schedule" && i + 1 < argc && parseSchedule(schedule, argv[i + 1]))
+    		i++;
+    	else if(sOption == "--tile" && i + 1 < argc && parseTile(schedule, argv[i + 1]))
+    		i++;
+    	else if(sOption == "--stats" && i + 1 < argc)
+    		sStatsFile = argv[++i];
+    	else if(sOption == "--cycle-period" && i + 1 < argc && atoi(argv[i + 1]) > 0)
+    		iCyclePeriod = atoi(argv[++i]);
+    	else if(sOption == "--stop-on-cycle")
+    		iStopOnCycle = 1;
+    	else
+    	{
+    		printUsage();
+    		return -1;
+    	}
+    }
+
+    // The blocks would have to follow the pattern across the processes
+    if(boundary == LIFE_BOUNDARY_GROW)
+    {
+    	printf("A growing grid is computed by the serial program only.\n");
+    	return -1;
+    }
+
+    if(!sCheckpointFile && (iCheckpointEvery || dCheckpointSeconds > 0 || iRestart))
+    {
+    	printf("The checkpoint options need --checkpoint <file>.\n");
+    	return -1;
+    }
+
+    // A restart continues from the checkpoint, as long as there is one
+    const char *sInputFile = argv[1];
+    int iRestarted = iRestart && isLifeFile(sCheckpointFile);
+    if(iRestarted)
+    	sInputFile = sCheckpointFile;
+
+    // An RLE pattern brings its rule along (a restart from its checkpoint as well) and its place on the plane
+    LifeRle rle;
+    long long lRowOrigin = 0, lColumnOrigin = 0;
+    int iRleInput = isRleFile(argv[1]);
+    if(iRleInput)
+    {
+    	if(!openRle(rle, argv[1]))
+    		return -1;
+    	lRowOrigin = rle.lRowOrigin;
+    	lColumnOrigin = rle.lColumnOrigin;
+    	if(!iRuleGiven && rle.sRule[0] && !parseRule(rule, rle.sRule))
+    	{
+    		printf("The rule %s of the input file is not supported.\n", rle.sRule);
+    		return -1;
+    	}
+    }
+
+    // The kernels of the rule, for the whole run. A generation reads iRadius rows and columns around every cell:
+    // the halos hold iHaloCells = iHaloDepth * iRadius rows and columns for iHaloDepth generations.
+    setKernelRule(rule);
+    int iRadius = rule.iRadius, iHaloCells = iHaloDepth * iRadius;
+
     // Getting values from the argument
-    ifstream fInput(argv[1]);
+    ifstream fInput(sInputFile);
     int thread_count = atoi(argv[2]);
     int iGenerations = atoi(argv[3]);
-    ofstream fOutput(argv[4]);
 
     // Checking whether the input file exists in the directory or not
     if (!fInput)
@@ -150,47 +240,178 @@ int main(int argc, char *argv[])
 		return -1;
 	}
 
-	// Initialize the MPI environment
-    MPI_Init(NULL, NULL);
+	// Initialize the MPI environment: only the master thread of the team calls MPI
+	int iThreadSupport;
+    MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &iThreadSupport);
 
     // Get the number of processes
     int world_size, world_rank;
     MPI_Comm_size(MPI_COMM_WORLD, &world_size); // Total number of processes
     MPI_Comm_rank(MPI_COMM_WORLD, &world_rank); // Rank of processes starting from 0 till (world_size - 1)
 
+    if(iThreadSupport < MPI_THREAD_FUNNELED && world_rank == 0)
+    	cout << "The MPI library does not support calls from the master thread of a team (MPI_THREAD_FUNNELED)" << endl;
+
     // Initializing necessary variables
-	int iRowCount, iColumnCount, iNeighborStatus, iChunkSize, iChunkRemainder, iStartRowIndex, iEndRowIndex;
+	int iRowCount, iColumnCount;
 	char cItem;
 
 	// Execution time calculation variables
 	double dStartTime, dEndTime;
 
-	// Getting the grid dimension from the first line of the input file
-	fInput >> iRowCount >> iColumnCount;
+	// A binary grid file is mapped into memory, its header holds the grid dimension and the generation
+	LifeFile fileGrid;
+	int iBinaryInput = isLifeFile(sInputFile);
+	uint64_t uGeneration = 0;
+	MPI_Offset iHeaderSize = 0;
+
+	if(iBinaryInput)
+	{
+		if(!openLifeFile(fileGrid, sInputFile))
+		{
+			MPI_Finalize();
+			return -1;
+		}
+		iRowCount = (int) fileGrid.header.uRowCount;
+		iColumnCount = (int) fileGrid.header.uColumnCount;
+		uGeneration = fileGrid.header.uGeneration;
+
+		// The run still ends at the generation it was started for
+		if(iRestarted)
+		{
+			uint64_t uStartGeneration = 0;
+			LifeFile fileStart;
+			if(isLifeFile(argv[1]) && openLifeFile(fileStart, argv[1]))
+			{
+				uStartGeneration = fileStart.header.uGeneration;
+				closeLifeFile(fileStart);
+			}
+			else if(iRleInput)
+			{
+				uStartGeneration = rle.uGeneration;
+				closeRle(rle);
+				iRleInput = 0;
+			}
+
+			iGenerations = (uGeneration >= uStartGeneration + iGenerations) ? 0 : (int) (uStartGeneration + iGenerations - uGeneration);
+			if(world_rank == 0)
+				cout << "Restarting from generation " << uGeneration << " of " << sCheckpointFile << ", " << iGenerations << " generations to go" << endl;
+		}
+	}
+	else if(iRleInput)
+	{
+		// The header of an RLE pattern holds the grid dimension and the generation
+		iRowCount = rle.iRowCount;
+		iColumnCount = rle.iColumnCount;
+		uGeneration = rle.uGeneration;
+	}
+	else
+	{
+		// Getting the grid dimension from the first line of the input file
+		fInput >> iRowCount >> iColumnCount;
+		fInput.ignore(numeric_limits<streamsize>::max(), '\n');
+		iHeaderSize = fInput.tellg(); // The rows start behind the first line
+	}
 	iActualRowCount = iRowCount + 2; // Two new layers will be added: Top and Bottom
 	iActualColumnCount = iColumnCount + 2; // Two new layers will be added: Left and 
 
 	//cout << iRowCount << "\t" << iColumnCount << endl;
 
-	// Imposing the condition: Size of the processes will not exceed the number of rows of the grid
-    if(world_size > iRowCount)
-    {
-    	cout << "Defined Processes: " << world_size << " | Number of the Grid's Row: " << iRowCount << endl;
-    	cout << "Size of the processes will not exceed the number of rows of the grid" << endl;
-    	return -1;
-    }
+	// The processes form a 2D grid of blocks, each block needs at least as many rows and columns as the halos
+	LifeDomain domain;
+	if(!createDomain(domain, MPI_COMM_WORLD, iRowCount, iColumnCount, iHaloCells, boundary == LIFE_BOUNDARY_TORUS))
+	{
+		if(world_rank == 0)
+		{
+			cout << "Defined Processes: " << world_size << " | Grid Size: " << iRowCount << " * " << iColumnCount << " | Halo Depth: " << iHaloDepth << endl;
+			cout << "The processes can not be arranged into blocks of at least " << iHaloCells << " rows and columns" << endl;
+		}
+		if(iBinaryInput)
+			closeLifeFile(fileGrid);
+		if(iRleInput)
+			closeRle(rle);
+		MPI_Finalize();
+		return -1;
+	}
+
+	// Every process holds its block with the halos on each side (iHaloCells rows and columns)
+	allocateGrids(domain.iRowCount + 2 * iHaloCells, domain.iColumnCount + 2 * iHaloCells);
+
+	// The threads share the tiles of the rows by the schedule of the command line
+	applySchedule(schedule);
 
-	iChunkSize =  iRowCount / world_size; // Calculating the size of the chunk against each processes
-	iChunkRemainder = iRowCount % world_size; // Calculating the remainder to deal with the odd number of processes for later on.
+	// Words reading the left halo (up to the one of column iHaloCells + iRadius - 1) and the right halo (from the one
+	// of the column iRadius before the right halo on)
+	int iFirstInnerWord = (iHaloCells + iRadius - 1) / LIFE_WORD_BITS + 1;
+	int iLastColumnWord = (domain.iColumnCount + iHaloCells - iRadius) / LIFE_WORD_BITS;
+	if(iFirstInnerWord > iLastColumnWord)
+		iFirstInnerWord = iLastColumnWord = grid.iWordCount;
 
-	// Process 0 will initialize the grid and distribute the tasks to other processes
+	// Every thread touches the tiles it computes first, their pages land on the NUMA node of the thread
+	placeGrid(schedule, grid, thread_count, iHaloCells + iRadius, grid.iRowCount - iHaloCells - iRadius, iFirstInnerWord, iLastColumnWord);
+	placeGrid(schedule, gridNew, thread_count, iHaloCells + iRadius, grid.iRowCount - iHaloCells - iRadius, iFirstInnerWord, iLastColumnWord);
+
+	// Measure the starting clock time
 	if(world_rank == 0)
-	{
-		// Measure the starting clock time
         dStartTime = MPI_Wtime();
 
-		// Allocate 2D arrays dynamically
-		allocateGrids(iActualRowCount, iActualColumnCount);
+	// Each process unpacks its own block straight from the mapping of a binary grid file
+	int iParallelInput = iBinaryInput || iRleInput;
+	if(iBinaryInput)
+	{
+		int iValid = readBlockFile(fileGrid, domain, grid);
+		closeLifeFile(fileGrid);
+
+		if(!iValid)
+		{
+			if(world_rank == 0)
+				cout << "The checksum of " << sInputFile << " does not match its grid" << endl;
+			MPI_Finalize();
+			return -1;
+		}
+
+		if(world_rank == 0)
+			cout << "Binary file input completed.. " << endl;
+	}
+	else if(iRleInput)
+	{
+		// Every process goes through the runs of the pattern and keeps the live cells of its own block
+		// (all of them read the same runs, so either all or none of them find them broken)
+		int iValid = readRleCells(rle, grid, iHaloCells, iHaloCells, domain.iRowStart - 1, domain.iRowCount, domain.iColumnStart - 1, domain.iColumnCount);
+		closeRle(rle);
+
+		if(!iValid)
+		{
+			MPI_Finalize();
+			return -1;
+		}
+
+		if(world_rank == 0)
+			cout << "RLE pattern input completed.. " << endl;
+	}
+	else
+	{
+		// A file of the fixed-width format is read by all processes at once, each one reads its own block
+		MPI_File fileInput;
+		MPI_File_open(MPI_COMM_WORLD, sInputFile, MPI_MODE_RDONLY, MPI_INFO_NULL, &fileInput);
+		iParallelInput = isFixedWidthInput(fileInput, iHeaderSize, iRowCount, iColumnCount);
+
+		if(iParallelInput)
+		{
+			readBlock(fileInput, iHeaderSize, iRowCount, iColumnCount, domain, grid);
+
+			if(world_rank == 0)
+				cout << "Parallel file input completed.. " << endl;
+		}
+		MPI_File_close(&fileInput);
+	}
+
+	// Otherwise process 0 will initialize the grid and distribute the tasks to other processes
+	if(!iParallelInput && world_rank == 0)
+	{
+		// Allocate the bit-packed grid, the whole grid lives in process 0 only
+		LifeGrid gridGlobal;
+		allocateGrid(gridGlobal, iActualRowCount, iActualColumnCount);
 
 		cout << "Allocating grid successfully" << endl;
 
@@ -209,417 +430,494 @@ int main(int argc, char *argv[])
 			if((iCounterColumn > iColumnCount) || (iCounterRow > iRowCount))
 				continue;
 
-			//cout << cItem << "\n";
-			iGrid[iCounterRow][iCounterColumn] = cItem - '0';
-			//cout << iGrid[iCounterRow][iCounterColumn] << endl;
-			
-			//cout << "Row: " << iCounterRow << " , Column: " << iCounterColumn << endl;
+			setCell(gridGlobal, iCounterRow, iCounterColumn, cItem - '0');
 			iCounterColumn++;
 		}
 		cout << "Row: " << iCounterRow << " , Column: " << iCounterColumn << endl;
 
 		cout << "Exit from file input buffering" << endl;
 
-		// As the file has read properly, now it's time to add outer layers
-		addOuterLayers();
-
 		cout << "File input completed.. " << endl;
-		//printGrid(1, iActualRowCount - 1, 1, iActualColumnCount - 1);
 		cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
 
-		//cout << thread_count << " " << world_size << endl;
-
-		// Calculating the starting and end index for processes 0
-		iStartRowIndex = ((0 * iChunkSize) + 1);
-		iEndRowIndex = iStartRowIndex + iChunkSize;
-
-		// Adding outer layer into consideration
-		iStartRowIndex -= 1;
-		iEndRowIndex += 1;
-
-
 		for(int i = 1; i < world_size; i++) 
         {
-        	int iSizeOfTheBuffer;
-
-            // Last process will avail the chuck size and the remainder
-            if(i == (world_size - 1))
-            {
-            	// Calculating the starting and end index for each processes
-				iStartRowIndex = ((i * iChunkSize) + 1);
-				if(iChunkRemainder)	// Last process will consider the remainder
-					iChunkSize = iChunkSize + iChunkRemainder;
-				iEndRowIndex = iStartRowIndex + iChunkSize;
-				
-				// Adding outer layer into consideration
-				iStartRowIndex -= 1;
-				iEndRowIndex += 1;
-
-                // Initialzing the grid slice which needs to be passed via MPI Send
-                int iSizeOfTheRow = iEndRowIndex - iStartRowIndex;
-              
-                // Calculate the buffer size
-                iSizeOfTheBuffer = iSizeOfTheRow * iActualColumnCount;
-
-                // Create a local copy
-				int *iGridSlice = new int[iSizeOfTheBuffer];
-
-                // Sending the size of the row
-                MPI_Send(&iSizeOfTheRow, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "IF block for Process " << i << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-                //cout << "Start Row Index: " << iStartRowIndex << " | End Row Index: " << iEndRowIndex << endl;
-
-                for(int j = iStartRowIndex, k = 0; j < iEndRowIndex; j++, k++)
-                {
-                	for(int l = 0; l < iActualColumnCount; l++)
-            		{
-                 		iGridSlice[(k*iActualColumnCount)+l] = iGrid[j][l];
-                 		//cout << iGridSlice[(k*iActualColumnCount)+l] << " ";
-                  	}
-                  	//cout << endl;
-                }
-                //cout << iGridSlice[iSizeOfTheBuffer-2] << endl;
-
-                //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-
-                // Sending the buffer to the last process
-                MPI_Send(iGridSlice, iSizeOfTheBuffer, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "Task distribution send completed.." << endl;
-
-                // free the allocated array
-				delete[] iGridSlice;
-			}            
-
-            // Rest of the other processes (1 to n-1) will avail the chunk size partioning only.
-            else 
-            {
-            	// Calculating the starting and end index for each processes
-				iStartRowIndex = ((i * iChunkSize) + 1);
-				iEndRowIndex = iStartRowIndex + iChunkSize;
-				
-				// Adding outer layer into consideration
-				iStartRowIndex -= 1;
-				iEndRowIndex += 1;
-
-                // Initialzing the grid slice which needs to be passed via MPI Send
-                int iSizeOfTheRow = iEndRowIndex - iStartRowIndex;
-              
-                // Calculate the buffer size
-                iSizeOfTheBuffer = iSizeOfTheRow * iActualColumnCount;
-
-                // Create a local copy
-				int *iGridSlice = new int[iSizeOfTheBuffer];
-
-                // Sending the size of the row
-                MPI_Send(&iSizeOfTheRow, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "IF block for Process " << i << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-                //cout << "Start Row Index: " << iStartRowIndex << " | End Row Index: " << iEndRowIndex << endl;
-
-                for(int j = iStartRowIndex, k = 0; j < iEndRowIndex; j++, k++)
-                {
-                	for(int l = 0; l < iActualColumnCount; l++)
-            		{
-                 		iGridSlice[(k*iActualColumnCount)+l] = iGrid[j][l];
-                 		//cout << iGridSlice[(k*iActualColumnCount)+l] << " ";
-                  	}
-                  	//cout << endl;
-                }
-                //cout << iGridSlice[iSizeOfTheBuffer-2] << endl;
-
-                //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-
-                // Sending the buffer to the last process
-                MPI_Send(iGridSlice, iSizeOfTheBuffer, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "Task distribution send completed.." << endl;
-
-                // free the allocated array
-				delete[] iGridSlice;
-			}
+        	// Block of the process, the halos come from the neighbours later on
+        	int iBlockRowStart, iBlockRowSize, iBlockColumnStart, iBlockColumnSize;
+        	blockOf(domain, i, iBlockRowStart, iBlockRowSize, iBlockColumnStart, iBlockColumnSize);
+
+            // The block is cut out of the grid into a grid laid out as the one of the process
+            LifeGrid gridBlock;
+            allocateGrid(gridBlock, iBlockRowSize + 2 * iHaloCells, iBlockColumnSize + 2 * iHaloCells);
+            copyBlock(gridBlock, iHaloCells, iHaloCells, gridGlobal, iBlockRowStart, iBlockColumnStart, iBlockRowSize, iBlockColumnSize);
+
+            // Sending the rows of the block to the process
+            MPI_Send(getRow(gridBlock, iHaloCells), iBlockRowSize * gridBlock.iStride, MPI_UINT64_T, i, 1, MPI_COMM_WORLD);
+            freeGrid(gridBlock);
         }
+
+        // Own block of process 0
+        copyBlock(grid, iHaloCells, iHaloCells, gridGlobal, domain.iRowStart, domain.iColumnStart, domain.iRowCount, domain.iColumnCount);
+        freeGrid(gridGlobal);
         cout << "Task distribution send completed.." << endl;
 	}
-	else
+	else if(!iParallelInput)
 	{
-		// Let all the processes get synchronized
-	    //MPI_Barrier(MPI_COMM_WORLD);
+		// Time to receive the rows of the block straight into the grid
+	    MPI_Recv(getRow(grid, iHaloCells), domain.iRowCount * grid.iStride, MPI_UINT64_T, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	}
+	copyGrid(gridNew, grid);
+
+	iRowCount = grid.iRowCount;
+
+	// The grids of even and odd levels while a process advances iHaloDepth generations between two exchanges
+	LifeGrid *grids[2] = { &grid, &gridNew };
+
+	cout << "Process " << world_rank << " | Block (" << domain.iCoords[0] << ", " << domain.iCoords[1] << ") of " << domain.iDims[0] << " * " << domain.iDims[1] << endl;
+	cout << "Row Index Starts: " << domain.iRowStart << " | Row Index Ends: " << (domain.iRowStart + domain.iRowCount) << " | Column Starts: " << domain.iColumnStart << " | Column Ends: " << (domain.iColumnStart + domain.iColumnCount) << endl;  
+
+	// Where the threads run and where the cells of the block live
+	reportPlacement(grid, world_rank, thread_count);
+
+	// Buffers and persistent requests of the halo exchange with the eight neighbours are set up once
+	LifeHalo halo;
+	createHalo(halo, grid, gridNew, domain);
+
+	// Sparse grids: only the tiles around the changes of the last generation are computed
+	LifeActivity activity;
+	if(iSparse)
+		createActivity(activity, grid, iHaloCells, iRadius);
+
+	// Statistics of the generations: the threads count the cells they compute, the processes add up their blocks once per generation
+	int iCounting = (sStatsFile != NULL) || iStopOnCycle, iStop = 0;
+	LifeStats stats;
+	LifeStats *pCounted = NULL;
+	LifeGeneration generation;
+	LifeCycle cycle;
+	FILE *pStats = NULL;
+	MPI_Datatype generationType;
+	MPI_Op combineOp;
+	if(iCounting)
+	{
+		int iOpened = (world_rank != 0) || !sStatsFile || (pStats = fopen(sStatsFile, "w")) != NULL;
+		MPI_Bcast(&iOpened, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		if(!iOpened)
+		{
+			if(world_rank == 0)
+				cout << "Unable to write the statistics to " << sStatsFile << endl;
+			MPI_Finalize();
+			return -1;
+		}
 
-	    // Receiving the size of row first
-	    MPI_Recv(&iRowCount, 1, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+		MPI_Type_contiguous(sizeof(LifeGeneration), MPI_BYTE, &generationType);
+		MPI_Type_commit(&generationType);
+		MPI_Op_create(combineGenerationsOp, 1, &combineOp);
 
-	    //cout << "Process: " << world_rank << endl;
+		createBlockStats(stats, domain, iHaloCells, lRowOrigin, lColumnOrigin, thread_count, uGeneration);
+		pCounted = &stats;
+		createCycle(cycle, iCyclePeriod);
+		MPI_Allreduce(&stats.generation, &generation, 1, generationType, combineOp, MPI_COMM_WORLD);
+		findCycle(cycle, generation);
+		if(pStats)
+		{
+			writeStatsHeader(pStats);
+			writeGeneration(pStats, generation);
+		}
+	}
 
-		// Calculate the buffer size (for each process)
-	    int iSizeOfTheBuffer = iRowCount * iActualColumnCount;
+	// Checkpoints of the run
+	LifeCheckpoint checkpoint;
+	if(sCheckpointFile)
+		createCheckpoint(checkpoint, domain, iActualColumnCount - 2, sCheckpointFile, iCheckpointEvery, dCheckpointSeconds, uGeneration);
+
+	// Snapshots of the run, starting with the given state: process 0 writes the stream, all processes send their blocks
+	LifeStream stream;
+	LifeGather gather;
+	uint64_t uLastSnapshot = uGeneration;
+	int iGatherPending = 0;
+	if(sSnapshotFile)
+	{
+		int iOpened = (world_rank != 0) || openStream(stream, sSnapshotFile, iSnapshotEvery, uGeneration);
+		MPI_Bcast(&iOpened, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		if(!iOpened)
+		{
+			MPI_Finalize();
+			return -1;
+		}
 
-	    // Create a local copy
-		int *iGridLocal = new int[iSizeOfTheBuffer];
-		
-		// Let all the processes get synchronized
-	    //MPI_Barrier(MPI_COMM_WORLD);
+		unsigned char *cRows = gatherRows(domain, grid, iActualRowCount - 2, iActualColumnCount - 2);
+		if(world_rank == 0)
+			queueFrame(stream, cRows, iActualRowCount - 2, iActualColumnCount - 2, uGeneration, 0, 0);
+	}
 
-		// Time to receive the slice grids
-	    MPI_Recv(iGridLocal, iSizeOfTheBuffer, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+	// Tiles computed as a whole, ring tiles computed next to the halos only and tiles of the grid so far (sparse grids)
+	long lTileCount = 0, lRingCount = 0, lTileTotal = 0;
 
-		//cout << "Process: " << world_rank << " | Number of Rows: " << iRowCount << " | Number of Columns: " << iActualColumnCount << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-		
-		// Now, create two grids for generations.
-		allocateGrids(iRowCount, iActualColumnCount);
+	// Time spent computing the block since the blocks were balanced last (waiting for the halos left out)
+	double dComputeTime = 0;
+	int iBalancedSteps = 0, iBalanceCount = 0;
 
-		// Let all the processes get synchronized
-	    //MPI_Barrier(MPI_COMM_WORLD);
+	// New boundaries of the blocks once they move, and the grid of the new block, placed by the team before the cells come in
+	int *iNewRowStarts = (int *) malloc((domain.iDims[0] + domain.iDims[1] + 2) * sizeof(int));
+	int *iNewColumnStarts = iNewRowStarts + domain.iDims[0] + 1;
+	int iMoved = 0;
+	LifeGrid gridBlock;
 
-		// Assigning 1D array values to 2D above created array
-		int iTempIndex = 0;
-		for(int i = 0; i < iRowCount; i++)
+	// All set for the game: every exchange of the halos is good for iHaloDepth generations. One team of threads runs
+	// through all generations, the master thread alone talks to the other processes (MPI_THREAD_FUNNELED).
+	#pragma omp parallel num_threads(thread_count)
+	{
+		int iMyRank = omp_get_thread_num(); //What thread am I?
+		double dStepTime = 0, dHaloTime;
+
+		for(int iSteps = 1; iSteps <= iGenerations; iSteps += iHaloDepth)
 		{
-			for(int j = 0; j < iActualColumnCount; j++)
+			int iLevels = (iGenerations - iSteps + 1 < iHaloDepth) ? iGenerations - iSteps + 1 : iHaloDepth;
+			int iCycleClosed = 0;
+
+			// Processes synchronize only through the halo messages
+			#pragma omp master
 			{
-				iGrid[i][j] = iGridNew[i][j] = iGridLocal[iTempIndex];
-				iTempIndex += 1;
-				//cout << iGrid[i][j] << " ";
+				dStepTime = MPI_Wtime();
+				startHalo(halo, grid);
+
+				if(iSparse)
+				{
+					beginActivity(activity);
+					listActiveTiles(activity, LIFE_TILES_INNER);
+				}
 			}
-			//cout << endl;
-		}
+			#pragma omp barrier
 
-		//cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-	}
+			if(iSparse)
+			{
+				// The inner tiles are computed while the halos are on their way, the ring once they are in
+				nextGenerationTiles(activity, grid, gridNew, 1, iMyRank, pCounted);
 
-	if(world_rank == 0)
-		iRowCount =  iEndRowIndex - iStartRowIndex;
+				#pragma omp master
+				{
+					dHaloTime = MPI_Wtime();
+					finishHalo(halo, grid);
+					dStepTime += MPI_Wtime() - dHaloTime;
+				}
+				#pragma omp barrier
 
-	int iThreadChunk = iRowCount / thread_count;
-	int iThreadChunkRemainder = iRowCount % thread_count;
-	int iThreadStartIndex = -1, iThreadEndIndex = -1;
+				#pragma omp single
+				{
+					compareHalos(activity, grid);
+					listActiveTiles(activity, LIFE_TILES_RING);
+				}
 
-	// Let all the processes get synchronized
-	//MPI_Barrier(MPI_COMM_WORLD);
+				nextGenerationTiles(activity, grid, gridNew, 1, iMyRank, pCounted);
+				#pragma omp barrier
 
-	cout << "Process " << world_rank << endl;
-	cout << "Row Index Starts: 1 | Row Index Ends: " << (iRowCount - 1) << " | Column Starts: 1 | Column Ends: " << (iActualColumnCount - 1) << endl;  
+				#pragma omp single
+				endActivity(activity);
 
-	/*for(int i = 1; i < (iRowCount - 1); i++)
-	{
-		for(int j = 1; j < (iActualColumnCount - 1); j++)
-			cout << iGrid[i][j] << " ";
-		cout << endl;
-	}
-	cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;*/
+				// Further generations within the halos, level by level, unless the last one closed a cycle
+				for(int iLevel = 2; iLevel <= iLevels; iLevel++)
+				{
+					if(pCounted)
+					{
+						#pragma omp master
+						iStop = countGeneration(stats, *grids[(iLevel - 1) % 2], generation, cycle, pStats, generationType, combineOp) && iStopOnCycle;
+						#pragma omp barrier
 
-	// All set for the game
-	for(int iSteps = 1; iSteps <= iGenerations; iSteps++)
-	{
-		// Let all the processes get synchronized
-    	MPI_Barrier(MPI_COMM_WORLD);
-    	
-    	//cout << "Process: " << world_rank << " | Generation: " << iSteps << " | Row Count: " << iRowCount << endl;
+						if(iStop)
+						{
+							iCycleClosed = 1;
+							iLevels = iLevel - 1;
+							break;
+						}
+					}
 
-    	if(iSteps != 1) // Performing halo exchange from 2nd generation onwards
-    	{
-    		
-    		// Create local copies
-			int *topRowSend = new int[iActualColumnCount - 2];
-			int *topRowRecv = new int[iActualColumnCount - 2];
-			int *bottomRowSend = new int[iActualColumnCount - 2];
-			int *bottomRowRecv = new int[iActualColumnCount - 2];
-
-			// Copying row elements
-			for(int i = 1; i < iActualColumnCount - 1; i++)
-			{
-				topRowSend[i] = iGrid[1][i];
-				bottomRowSend[i] = iGrid[iRowCount-2][i];
-				//cout << world_rank << " | " << topRowSend[i] << " " << bottomRowSend[i] << endl;
-			}
-    		    					
-			// Bottom halo exchange
-			// For example, bottow row of Process 0 will be transferred to the top row of Process 1
-			MPI_Sendrecv(bottomRowSend, iActualColumnCount - 2, MPI_INT,
-                ((world_rank - 1) + world_size) % world_size, 1,
-                topRowRecv, iActualColumnCount - 2, MPI_INT,
-                ((world_rank + 1) + world_size) % world_size, 1,
-                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-			// Top halo exchange
-			// For example, top row of Process 1 will be transferred to the bottom row of Process 0
-    		MPI_Sendrecv(topRowSend, iActualColumnCount - 2, MPI_INT,
-                ((world_rank + 1) + world_size) % world_size, 2,
-                bottomRowRecv, iActualColumnCount - 2, MPI_INT,
-                ((world_rank - 1) + world_size) % world_size, 2,
-                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-			// Now updating the rows of the grid
-			for(int i = 1; i < iActualColumnCount - 1; i++)
-			{
-				iGrid[0][i] = topRowRecv[i];
-				iGrid[iRowCount-1][i] = bottomRowRecv[i];
-				//cout << world_rank << " | " << topRowRecv[i] << " " << bottomRowRecv[i] << endl;
-			}
+					#pragma omp single
+					{
+						clearBoundaryHalos(halo, *grids[(iLevel - 1) % 2]);
+						beginActivity(activity);
+						listActiveTiles(activity, LIFE_TILES_ALL);
+					}
 
-			// Now updating the columns of the grid
-			for(int i = 0; i < iActualColumnCount; i++)
-			{
-				// Add left layer which is the copy of the iColumnCount st stride column-wise.
-				for(int i = 1; i <= (iRowCount - 2); i++)
-					iGrid[i][0] = iGrid[i][iActualColumnCount - 2];
+					nextGenerationTiles(activity, *grids[(iLevel - 1) % 2], *grids[iLevel % 2], iLevel, iMyRank, pCounted);
+					#pragma omp barrier
 
-				// Add right layer which is the copy of the 1 st stride column-wise.
-				for(int i = 1; i <= (iRowCount - 2); i++)
-					iGrid[i][iActualColumnCount-1] = iGrid[i][1];
+					#pragma omp single
+					endActivity(activity);
+				}
 			}
+			else
+			{
+				// Rows (iHaloCells + iRadius) .. (iRowCount - iHaloCells - iRadius - 1) do not need the top and bottom halos, their words
+				// between iFirstInnerWord and iLastColumnWord not the left and right halos either. The master thread waits for the halos
+				// as soon as it is done with its tiles, the other threads go on with theirs.
+				int iInnerStart = iHaloCells + iRadius, iInnerEnd = iRowCount - iHaloCells - iRadius;
+				nextGenerationScheduled(schedule, grid, gridNew, iInnerStart, iInnerEnd, iFirstInnerWord, iLastColumnWord, pCounted);
+
+				// The halos must have arrived (and the edges sent) before the edges are computed
+				#pragma omp master
+				{
+					dHaloTime = MPI_Wtime();
+					finishHalo(halo, grid);
+					dStepTime += MPI_Wtime() - dHaloTime;
 
-			// Diagonal copies
-			iGrid[0][0] = iGrid[iRowCount - 2][iActualColumnCount - 2];	// Upper Left
-			iGrid[0][iActualColumnCount - 1] = iGrid[iRowCount - 2][1];	// Upper Right
-			iGrid[iRowCount - 1][0] = iGrid[1][iActualColumnCount - 2];	// Lower Left
-			iGrid[iRowCount - 1][iActualColumnCount - 1] = iGrid[1][1];	// Lower Right
-
-			cout << "Halo exchange successfully done for Process " << world_rank << endl;
+					cout << "Halo exchange successfully done for Process " << world_rank << endl;
+				}
+				#pragma omp barrier
 
-			// free the allocated array
-			delete[] topRowSend;
-			delete[] topRowRecv;
-			delete[] bottomRowSend;
-			delete[] bottomRowRecv;
-    	}
+				// First and last words of the inner rows, now with the left and right halos
+				#pragma omp single nowait
+				if(iInnerEnd > iInnerStart)
+				{
+					nextGenerationWords(grid, gridNew, iInnerStart, iInnerEnd, 0, iFirstInnerWord);
+					if(iLastColumnWord < grid.iWordCount)
+						nextGenerationWords(grid, gridNew, iInnerStart, iInnerEnd, iLastColumnWord, grid.iWordCount);
+					if(pCounted)
+					{
+						scanStats(stats, iMyRank, grid, gridNew, iInnerStart, iInnerEnd, 0, iFirstInnerWord);
+						scanStats(stats, iMyRank, grid, gridNew, iInnerStart, iInnerEnd, iLastColumnWord, grid.iWordCount);
+					}
+				}
 
-		// geting into the OpenMP parallel region
-		#pragma omp parallel firstprivate(iThreadStartIndex, iThreadEndIndex) num_threads(thread_count)
-    	{
-    		int iMyRank = omp_get_thread_num(); //What thread am I?
-    		
-    		// Computing two varibles to buffer through the grid which are derivatives from iMyRank variable
-    		iThreadStartIndex = iMyRank * iThreadChunk;
-    		if((iThreadStartIndex + iThreadChunk) > iRowCount)
-    			iThreadEndIndex = iThreadChunkRemainder;
-    		else
-    			iThreadEndIndex = iThreadStartIndex + iThreadChunk;
-    		
-    		//cout << "Process: " << world_rank << " | Chunk: " << iThreadChunk << " | Thread: " << iMyRank << " | Start Index: " << iThreadStartIndex << " | End Index: " << iThreadEndIndex << endl;
-
-    		for(int i = iThreadStartIndex; i < iThreadEndIndex; i++) // Iteration through row
-    		{
-    			if(i == 0 || i == iRowCount-1) // Avoiding the halos
-    				continue;
-    			
-    			//cout << world_rank << "\t" << iMyRank << "\t" << i << endl;
-
-    			//for(int i = 1; i < (iRowCount - 1); i++) || Wrong!!!!
-					for(int j = 1; j < (iActualColumnCount - 1); j++) // Iteration through column
+				// Rows reading the top and bottom halos
+				int iTopEnd = (iInnerStart < iRowCount - 1) ? iInnerStart : iRowCount - 1;
+				int iBottomStart = (iInnerEnd > iTopEnd) ? iInnerEnd : iTopEnd;
+				nextGenerationScheduled(schedule, grid, gridNew, 1, iTopEnd, 0, grid.iWordCount, pCounted);
+				nextGenerationScheduled(schedule, grid, gridNew, iBottomStart, iRowCount - 1, 0, grid.iWordCount, pCounted);
+				#pragma omp barrier
+
+				// Further generations within the halos, every one of them valid on iRadius rows and columns less on each side.
+				// The bands of the temporal blocking lose a row per level, the wider neighbourhoods go level by level, as do
+				// the dead edges (their halos are dead again before every level) and the counted generations.
+				if(iLevels > 1 && (iRadius > 1 || !domain.iPeriodic || pCounted))
+				{
+					for(int iLevel = 2; iLevel <= iLevels; iLevel++)
+					{
+						if(pCounted)
 						{
-							iGridNew[i][j] = adjacentNeighbors(i, j);
-							//cout << iGridNew[i][j] << endl;
-							if (world_rank == 0)// && iMyRank == 0)
+							#pragma omp master
+							iStop = countGeneration(stats, *grids[(iLevel - 1) % 2], generation, cycle, pStats, generationType, combineOp) && iStopOnCycle;
+							#pragma omp barrier
+
+							if(iStop)
 							{
-								//cout << i << " " << j << " | " << iGridNew[i][j] << endl;
+								iCycleClosed = 1;
+								iLevels = iLevel - 1;
+								break;
 							}
 						}
-    		}
-    		//cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-    	}
-    	
-
-		// Time to create a copy of the new generated state to the older one
-		// as a reference to create the newer one in the next generation
-		copyGrid(iRowCount, iActualColumnCount);
-	}
 
-	// Let all the processes get synchronized
-	//MPI_Barrier(MPI_COMM_WORLD);
+						#pragma omp single
+						clearBoundaryHalos(halo, *grids[(iLevel - 1) % 2]);
 
-	/*cout << "Process " << world_rank << endl;
+						nextGenerationScheduled(schedule, *grids[(iLevel - 1) % 2], *grids[iLevel % 2], iLevel * iRadius, iRowCount - iLevel * iRadius, 0, grid.iWordCount, pCounted);
+						#pragma omp barrier
+					}
+				}
 
-	for(int i = 1; i < (iRowCount - 1); i++)
-	{
-		for(int j = 1; j < (iActualColumnCount - 1); j++)
-			cout << iGridNew[i][j] << " ";
-		cout << endl;
-	}*/
+				// The threads take bands of rows through all the levels (temporal blocking), then fill in between the bands.
+				else if(iLevels > 1)
+				{
+					int iBands = (iRowCount - 2) / (2 * iLevels - 2);
+					if(iBands > thread_count)
+						iBands = thread_count;
+					if(iBands < 1)
+						iBands = 1;
 
-	// Copy the final copy to a 1D array for sending it to 
-	if(world_rank)
-	{
-		//cout << "Process " << world_rank << " final copy." << endl;
-		int iTempIndex = 0;
-		int *iGridFinalLocal = new int[iRowCount*(iActualColumnCount - 2)];
+					int iBandStart = 1 + (iMyRank * (iRowCount - 2)) / iBands;
+					int iBandEnd = 1 + ((iMyRank + 1) * (iRowCount - 2)) / iBands;
 
-		for(int i = 1; i < (iRowCount - 1); i++)
-		{
-			for(int j = 1; j < (iActualColumnCount - 1); j++)
-			{
-				iGridFinalLocal[iTempIndex] = iGrid[i][j];
-				//cout << iGridFinalLocal[iTempIndex] << " ";
-				iTempIndex += 1;
-			}
-		}
+					if(iMyRank < iBands)
+						nextGenerationsTrapezoid(grids, iBandStart, iBandEnd, iLevels);
 
-		// Sending the size of the row
-		iRowCount = iRowCount - 2;
-        MPI_Send(&iRowCount, 1, MPI_INT, 0, 1, MPI_COMM_WORLD);
+					#pragma omp barrier
 
-        //cout << "Process: " << world_rank << " | Row Size: " << iRowCount << " | Buffer Size: " <<  iTempIndex << endl;
-        // Sending the buffer to process 0
-        MPI_Send(iGridFinalLocal, iTempIndex, MPI_INT, 0, 1, MPI_COMM_WORLD);
-	
-        //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+					if(iMyRank > 0 && iMyRank < iBands)
+						nextGenerationsTriangle(grids, iBandStart, iLevels);
 
-        // free the allocated array
-		delete[] iGridFinalLocal;
-		delete[] iGrid;
-		delete[] iGridNew;
-	}
-	
+					#pragma omp barrier
+				}
+			}
 
-	// Write the final state to the file
-	else    
-	{
-		cout << "Job done, writing to the file." << endl;
-		// First process 0 will write its own result to the file
-		cout << "Process 0" << endl;
-		for(int i = 1; i < (iRowCount - 1); i++)
-		{
-			for(int j = 1; j < (iActualColumnCount - 1); j++)
+			// The last level is counted as well (unless a level before closed the cycle the run ends with)
+			if(pCounted && !iCycleClosed)
 			{
-				//cout << iGrid[i][j]  << " "; 
-				fOutput << iGrid[i][j] << " ";
+				#pragma omp master
+				iStop = countGeneration(stats, *grids[iLevels % 2], generation, cycle, pStats, generationType, combineOp) && iStopOnCycle;
+				#pragma omp barrier
 			}
-			fOutput << endl;
-			//cout << endl;
-		}
 
-		// Last, time  other processes' result
-	    for(int i = 1; i < world_size; i++)
-	    {
-	    	// Receiving the size of row first
-    		MPI_Recv(&iRowCount, 1, MPI_INT, i, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-	    	
-    		int* iGridFinaLocalCopy = new int[iRowCount * (iActualColumnCount - 2)];
+			#pragma omp master
+			{
+				// The newest generation becomes the reference to create the newer one in the next generation:
+				// it lies in the new grid after an odd number of levels, only the grids are swapped, nothing is copied
+				if(iLevels % 2)
+					swapGrids(grid, gridNew);
+				if(iStop)
+					iGenerations = iSteps + iLevels - 1;
+
+				dComputeTime += MPI_Wtime() - dStepTime;
+				if(iSparse)
+					lTileTotal += (long) activity.iTileRowCount * activity.iTileColumnCount * iLevels;
+
+				// Snapshot of the newest generation when it is due, written while the next generations are computed
+				if(sCheckpointFile)
+					checkpointGeneration(checkpoint, domain, grid, iActualRowCount - 2, iActualColumnCount - 2, uGeneration + iSteps + iLevels - 1);
+
+				// The frame gathered during the last generation goes to the writer of process 0
+				if(iGatherPending)
+				{
+					unsigned char *cRows = finishGatherRows(gather);
+					if(world_rank == 0)
+						queueFrame(stream, cRows, iActualRowCount - 2, iActualColumnCount - 2, uLastSnapshot, 0, 0);
+					iGatherPending = 0;
+				}
 
-    		// Time to receive the final copy from other process
-    		MPI_Recv(iGridFinaLocalCopy, (iRowCount * (iActualColumnCount - 2)), MPI_INT, i, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+				// Frame of the stream when it is due: its rows reach process 0 during the next generation, the writer encodes
+				// it while the ones after are computed
+				if(sSnapshotFile && uGeneration + iSteps + iLevels - 1 - uLastSnapshot >= (uint64_t) iSnapshotEvery)
+				{
+					uLastSnapshot = uGeneration + iSteps + iLevels - 1;
+					startGatherRows(gather, domain, grid, iActualRowCount - 2, iActualColumnCount - 2);
+					iGatherPending = 1;
+				}
 
-    		cout << "Process " << i << endl;
+				// Every iBalanceEvery generations the blocks move towards even compute times, the cells to their new owners
+				iBalancedSteps += iLevels;
+				if(iBalanceEvery > 0 && iBalancedSteps >= iBalanceEvery && iSteps + iLevels <= iGenerations)
+				{
+					iMoved = balanceBoundaries(domain, dComputeTime, iActualRowCount - 2, iActualColumnCount - 2, iNewRowStarts, iNewColumnStarts);
+					if(iMoved)
+					{
+						// Both grids of the new block are allocated untouched, the team clears them below
+						int iNewRowSize = iNewRowStarts[domain.iCoords[0] + 1] - iNewRowStarts[domain.iCoords[0]];
+						int iNewColumnSize = iNewColumnStarts[domain.iCoords[1] + 1] - iNewColumnStarts[domain.iCoords[1]];
+						freeGrid(gridNew);
+						allocateGridUntouched(gridBlock, iNewRowSize + 2 * iHaloCells, iNewColumnSize + 2 * iHaloCells);
+						allocateGridUntouched(gridNew, iNewRowSize + 2 * iHaloCells, iNewColumnSize + 2 * iHaloCells);
+
+						iRowCount = gridBlock.iRowCount;
+						iFirstInnerWord = (iHaloCells + iRadius - 1) / LIFE_WORD_BITS + 1;
+						iLastColumnWord = (iNewColumnSize + iHaloCells - iRadius) / LIFE_WORD_BITS;
+						if(iFirstInnerWord > iLastColumnWord)
+							iFirstInnerWord = iLastColumnWord = gridBlock.iWordCount;
+					}
+					dComputeTime = 0;
+					iBalancedSteps = 0;
+				}
+			}
+			#pragma omp barrier
 
-			// Writing to file
-			for(int i = 0; i < (iRowCount * (iActualColumnCount - 2)); i++)
+			// Every thread touches the tiles of the new block it computes first, as for the grids of the first block
+			if(iMoved)
 			{
-				if(i % (iActualColumnCount - 2) == 0 && i != 0)
+				placeGridTeam(schedule, gridBlock, iHaloCells + iRadius, iRowCount - iHaloCells - iRadius, iFirstInnerWord, iLastColumnWord);
+				placeGridTeam(schedule, gridNew, iHaloCells + iRadius, iRowCount - iHaloCells - iRadius, iFirstInnerWord, iLastColumnWord);
+
+				#pragma omp master
 				{
-					fOutput << endl;
-					//cout << endl;
+					// The cells move into the new block, the other grid, the halo buffers and the tiles follow it
+					freeHalo(halo);
+					migrateBlocks(domain, grid, gridBlock, iNewRowStarts, iNewColumnStarts);
+					copyGrid(gridNew, grid);
+					createHalo(halo, grid, gridNew, domain);
+
+					if(iSparse)
+					{
+						lTileCount += activity.lTileCount;
+						lRingCount += activity.lRingCount;
+						freeActivity(activity);
+						createActivity(activity, grid, iHaloCells, iRadius);
+					}
+
+					// The cells of the new block are counted again, their hash stays as it is a sum over the plane
+					if(pCounted)
+					{
+						freeStats(stats);
+						createBlockStats(stats, domain, iHaloCells, lRowOrigin, lColumnOrigin, thread_count, uGeneration + iSteps + iLevels - 1);
+					}
+
+					iBalanceCount++;
+					iMoved = 0;
 				}
-				fOutput << iGridFinaLocalCopy[i] << " ";
-				//cout << iGridFinaLocalCopy[i] << " ";
+				#pragma omp barrier
 			}
-			fOutput << endl;
-			//cout << endl;
 
-			// free the allocated array
-			delete[] iGridFinaLocalCopy;
+			if(iStop)
+				break;
 		}
+	}
+
+	free(iNewRowStarts);
+
+	// Blocks the processes end up with
+	if(iBalanceCount > 0)
+		cout << "Process " << world_rank << " | Balanced Rows: " << domain.iRowStart << " .. " << (domain.iRowStart + domain.iRowCount) << " | Balanced Columns: " << domain.iColumnStart << " .. " << (domain.iColumnStart + domain.iColumnCount) << endl;
+
+	// The last snapshot must be on disk
+	if(sCheckpointFile)
+	{
+		finishCheckpoint(checkpoint, domain);
+		freeCheckpoint(checkpoint);
+	}
+
+	// The frame still gathered is queued, the frames queued are written by now
+	if(iGatherPending)
+	{
+		unsigned char *cRows = finishGatherRows(gather);
+		if(world_rank == 0)
+			queueFrame(stream, cRows, iActualRowCount - 2, iActualColumnCount - 2, uLastSnapshot, 0, 0);
+	}
+	if(sSnapshotFile && world_rank == 0)
+	{
+		if(!closeStream(stream))
+			cout << "Error writing the snapshot stream " << sSnapshotFile << endl;
+		cout << "Snapshots: " << stream.iFrameCount << " frames, " << stream.lBytesWritten << " bytes (waited for the writer "
+			 << stream.iWaitCount << " times)" << endl;
+	}
 
+	// All processes write their own blocks of the final state at once
+	if(world_rank == 0)
+		cout << "Job done, writing to the file." << endl;
+
+	if(isRleOutput(argv[4]))
+	{
+		// Only the runs of live cells go to process 0, which writes the pattern
+		long lRunCount;
+		LifeRun *runs = gatherRuns(domain, grid, lRunCount);
+		if(world_rank == 0)
+		{
+			if(!writeRleRuns(argv[4], runs, lRunCount, iActualRowCount - 2, iActualColumnCount - 2, rule, uGeneration + iGenerations, 0, 0))
+				cout << "Error writing the RLE pattern " << argv[4] << endl;
+			free(runs);
+		}
+	}
+	else
+	{
+		MPI_File fileOutput;
+		MPI_File_open(MPI_COMM_WORLD, argv[4], MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fileOutput);
+		MPI_File_set_size(fileOutput, 0);
+
+		if(isBinaryOutput(argv[4]))
+			writeBlockBinary(fileOutput, iActualRowCount - 2, iActualColumnCount - 2, uGeneration + iGenerations, domain, grid);
+		else
+			writeBlock(fileOutput, iActualRowCount - 2, iActualColumnCount - 2, domain, grid);
+
+		MPI_File_close(&fileOutput);
+	}
+
+	// Share of the tiles which had to be computed
+	if(iSparse)
+	{
+		long lTiles[3] = { lTileCount + activity.lTileCount, lRingCount + activity.lRingCount, lTileTotal };
+		long lTilesSum[3];
+		MPI_Reduce(lTiles, lTilesSum, 3, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+		lTileCount = lTilesSum[0];
+		lRingCount = lTilesSum[1];
+		lTileTotal = lTilesSum[2];
+	}
+
+	if(world_rank == 0)
+	{
 		// Measure the ending clock time
         dEndTime = MPI_Wtime();
 		
@@ -628,18 +926,51 @@ int main(int argc, char *argv[])
 
         cout << "\n\nProgram Configuration" << endl;
         cout << "Grid Size: " <<  iActualRowCount-2 << " * " << iActualColumnCount-2 << endl;
-        cout << "Processes: " << world_size  << " | Threads: " << thread_count << endl;
+        cout << "Processes: " << world_size << " (" << domain.iDims[0] << " * " << domain.iDims[1] << " blocks) | Threads: " << thread_count << endl;
         cout << "Number of generations: " << iGenerations << endl; 
+        char sRuleName[LIFE_RULE_NAME_SIZE];
+        formatRule(rule, sRuleName);
+        cout << "Rule: " << sRuleName << " (" << (isLargerThanLife(rule) ? "Larger than Life" : (isKernelRuleSpecialized() ? "specialized" : "generic")) << " kernel)" << endl;
+        cout << "Boundary: " << getBoundaryName(boundary) << endl;
+        cout << "Kernel: " << getRowKernelName() << " | Schedule: " << getScheduleName(schedule) << " of " << schedule.iTileRows << " * " << schedule.iTileWords * LIFE_WORD_BITS << " tiles" << endl;
+		if(iSparse && lTileTotal > 0)
+			cout << "Tiles computed: " << lTileCount << " of " << lTileTotal << " (" << (100.0 * lTileCount) / lTileTotal << "%) | Next to the halos only: "
+				 << lRingCount << " (" << (100.0 * lRingCount) / lTileTotal << "%)" << endl;
+		if(iBalanceEvery > 0)
+			cout << "Blocks balanced: " << iBalanceCount << " times" << endl;
+		if(iCounting)
+		{
+			if(cycle.iPeriod)
+				cout << "Cycle of period " << cycle.iPeriod << " closed at generation " << cycle.uGeneration << (iStopOnCycle ? ", the run stopped there" : "") << endl;
+			else
+				cout << "No cycle of a period up to " << iCyclePeriod << " found" << endl;
+			cout << "Population: " << generation.lPopulation << endl;
+		}
 		cout << "Last generation output has been written to file." << endl;
 	}
+
+	// Free the statistics, the tiles, the halo exchange, the process grid and the grids
+	if(iCounting)
+	{
+		if(pStats)
+			fclose(pStats);
+		freeStats(stats);
+		freeCycle(cycle);
+		MPI_Op_free(&combineOp);
+		MPI_Type_free(&generationType);
+	}
+	if(iSparse)
+		freeActivity(activity);
+	freeHalo(halo);
+	freeDomain(domain);
+	freeGrid(grid);
+	freeGrid(gridNew);
+
 	// Done reading from the file
 	fInput.close();
 
-	// Done writing to the file
-	fOutput.close();
-
 	// Finalize the MPI environment.
     MPI_Finalize();
 
 	return 0;
-}
\ No newline at end of file
+}
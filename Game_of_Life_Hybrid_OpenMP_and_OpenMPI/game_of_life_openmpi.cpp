@@ -11,7 +11,7 @@
  * Any dead cell with exactly three live neighbours becomes a live cell.
  *
  * @author Md. Ahsan Ayub
- * @version 2.2 04/15/2019 
+ * @version 2.3 10/17/2026 
  *
  */
 
@@ -21,12 +21,16 @@
 #include <stdlib.h>
 #include <mpi.h>
 
+// Including the bit-packed grid, its kernel and the halo exchange
+#include "life_grid.h"
+#include "life_kernel.h"
+#include "life_halo.h"
+
 using namespace std;
 
 // Declaring global grid array
-int **iGrid;
-//int **iGridProcessCopy;
-int **iGridNew;
+LifeGrid grid;
+LifeGrid gridNew;
 
 // Actial values will be initialized after knowing the user defined grid dimension
 int iActualRowCount = 0, iActualColumnCount = 0;
@@ -34,106 +38,30 @@ int iActualRowCount = 0, iActualColumnCount = 0;
 // Allocate the arrays
 void allocateGrids(int iRowSize, int iColumnSize)
 {
-	iGrid = new int*[iRowSize];
-	iGridNew = new int*[iRowSize]; // A copy of iGrid
-	for (int i = 0; i < iRowSize; i++)
-	{
-		iGrid[i] = new int[iColumnSize];
-		iGridNew[i] = new int[iColumnSize];
-	}
+	allocateGrid(grid, iRowSize, iColumnSize);
+	allocateGrid(gridNew, iRowSize, iColumnSize); // A copy of grid
 }
 
-// Add outer layers to the grid
-void addOuterLayers()
-{
-	// Add top layer which is the copy of the iRowCount th stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[0][i] = iGrid[iActualRowCount - 2][i];
-
-	// Add bottom layer which is the copy of the 1 st stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[iActualRowCount - 1][i] = iGrid[1][i];
-
-	// Add left layer which is the copy of the iColumnCount st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][0] = iGrid[i][iActualColumnCount - 2];
-
-	// Add right layer which is the copy of the 1 st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][iActualColumnCount-1] = iGrid[i][1];
-
-	// Diagonal copies
-	iGrid[0][0] = iGrid[iActualRowCount - 2][iActualColumnCount - 2];	// Upper Left
-	iGrid[0][iActualColumnCount - 1] = iGrid[iActualRowCount - 2][1];	// Upper Right
-	iGrid[iActualRowCount - 1][0] = iGrid[1][iActualColumnCount - 2];	// Lower Left
-	iGrid[iActualRowCount - 1][iActualColumnCount - 1] = iGrid[1][1];	// Lower Right
-}
-
-// Print routine of iGrid
+// Print routine of grid
 void printGrid(int iRowCountStart, int iRowCountEnd, int iColumnCountStart, int iColumnCountEnd)
 {
 	for(int i = iRowCountStart; i < iRowCountEnd; i++)
 	{
 		for(int j = iColumnCountStart; j < iColumnCountEnd; j++)
-			cout << iGrid[i][j] << " ";
+			cout << getCell(grid, i, j) << " ";
 		cout << endl;
 	}
 }
 
-// Copy routine to iGrid from iGridNew (to make a new state's copy)
-void copyGrid(int iRowCount, int iColumnCount)
-{
-	for(int i = 0; i < iRowCount; i++)
-		for(int j = 0; j < iColumnCount; j++)
-			iGrid[i][j] = iGridNew[i][j];
-}
-
-// Measure the neighbors' status of a particular cell
-int adjacentNeighbors(int i, int j)
-{
-	// Variables to calculate the number of alive and dead cells
-	int iAliveCount = 0, iDeadCount = 0;
-
-	iGrid[i - 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-
-	if(iAliveCount < 2)
-		// A cell dies of loneliness
-		return 0;
-
-	else if(iAliveCount > 3)
-		// A cell dies of overcrowding
-		return 0;
-
-	else if(iGrid[i][j] == 1 && (iAliveCount == 2 || iAliveCount == 3))
-		// Current cell is alive, and there are TWO (which will become three in total) and exactly THREE cells alive.
-		// Thus, the cell survives.s
-		return 1;
-
-	else if(iGrid[i][j] == 0 && iAliveCount == 3)
-		// Current cell is NOT alive; however, there are exactly THREE alive cells: thus, the cell is born.
-		return 1;
-	
-	else
-		// Very unlikely this will be executed
-		return 0;
-}
-
 // Add an outer layer of the whole array for the simplicity
 
 // Main function
 int main(int argc, char *argv[])
 {
 	// Checking the number of input has to be passed by the user
-	if (argc < 3)
+	if (argc != 4)
     {
-        printf("Usuage: ./<executable> <input_file> <iterations> <output_file>\n");
+        printf("Usuage: mpirun -np <# processes> ./<executable> <input_file> <iterations> <output_file>\n");
         return -1;
     }
 
@@ -158,14 +86,19 @@ int main(int argc, char *argv[])
     MPI_Comm_rank(MPI_COMM_WORLD, &world_rank); // Rank of processes starting from 0 till (world_size - 1)
 
     // Initializing necessary variables
-	int iRowCount, iColumnCount, iNeighborStatus, iChunkSize, iChunkRemainder, iStartRowIndex, iEndRowIndex;
+	int iRowCount, iColumnCount, iChunkSize, iChunkRemainder, iStartRowIndex, iEndRowIndex;
 	char cItem;
 
+	// Execution time calculation variables
+	double dStartTime, dEndTime;
+
 	// Getting the grid dimension from the first line of the input file
 	fInput >> iRowCount >> iColumnCount;
 	iActualRowCount = iRowCount + 2; // Two new layers will be added: Top and Bottom
 	iActualColumnCount = iColumnCount + 2; // Two new layers will be added: Left and 
 
+	//cout << iRowCount << "\t" << iColumnCount << endl;
+
 	// Imposing the condition: Size of the processes will not exceed the number of rows of the grid
     if(world_size > iRowCount)
     {
@@ -180,9 +113,14 @@ int main(int argc, char *argv[])
 	// Process 0 will initialize the grid and distribute the tasks to other processes
 	if(world_rank == 0)
 	{
-		// Allocate 2D arrays dynamically
+		// Measure the starting clock time
+        dStartTime = MPI_Wtime();
+
+		// Allocate the bit-packed grids
 		allocateGrids(iActualRowCount, iActualColumnCount);
 
+		cout << "Allocating grid successfully" << endl;
+
 		// Populating the array from file
 		int iCounterRow = 1, iCounterColumn = 1; // Ignoring 0 indexes, as it will later be added as outer layers!
 		while(fInput >> cItem)
@@ -192,215 +130,149 @@ int main(int argc, char *argv[])
 			{
 				iCounterRow++;
 				iCounterColumn = 1;
+				//cout << endl;
 			}
 
-			//cout << cItem << "\n";
-			iGrid[iCounterRow][iCounterColumn] = cItem - '0';
-			//cout << "Row: " << iCounterRow << " , Column: " << iCounterColumn << endl;
+			if((iCounterColumn > iColumnCount) || (iCounterRow > iRowCount))
+				continue;
+
+			setCell(grid, iCounterRow, iCounterColumn, cItem - '0');
 			iCounterColumn++;
 		}
+		cout << "Row: " << iCounterRow << " , Column: " << iCounterColumn << endl;
+
+		cout << "Exit from file input buffering" << endl;
 
 		// As the file has read properly, now it's time to add outer layers
-		addOuterLayers();
+		addOuterLayers(grid);
 
-		cout << "File Input: " << endl;
-		printGrid(1, iActualRowCount - 1, 1, iActualColumnCount - 1);
+		cout << "File input completed.. " << endl;
+		//printGrid(1, iActualRowCount - 1, 1, iActualColumnCount - 1);
 		cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
 
-		for(int i = 0; i < world_size; i++) 
-        {
-        	int iSizeOfTheBuffer;
-
-            // Last process will avail the chuck size and the remainder
-            if(i == (world_size - 1))
-            {
-            	// Calculating the starting and end index for each processes
-				iStartRowIndex = ((i * iChunkSize) + 1);
-				if(iChunkRemainder)	// Last process will consider the remainder
-					iChunkSize = iChunkSize + iChunkRemainder;
-				iEndRowIndex = iStartRowIndex + iChunkSize;
-				
-				// Adding outer layer into consideration
-				iStartRowIndex -= 1;
-				iEndRowIndex += 1;
-
-                // Initialzing the grid slice which needs to be passed via MPI Send
-                int iSizeOfTheRow = iEndRowIndex - iStartRowIndex;
-              
-                // Calculate the buffer size
-                iSizeOfTheBuffer = iSizeOfTheRow * iActualColumnCount;
-
-                // Create a local copy
-				int *iGridSlice = new int[iSizeOfTheBuffer];
-
-                // Sending the size of the row
-                MPI_Send(&iSizeOfTheRow, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "IF block for Process " << i << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-                //cout << "Start Row Index: " << iStartRowIndex << " | End Row Index: " << iEndRowIndex << endl;
-
-                for(int j = iStartRowIndex, k = 0; j < iEndRowIndex; j++, k++)
-                {
-                	for(int l = 0; l < iActualColumnCount; l++)
-            		{
-                 		iGridSlice[(k*iActualColumnCount)+l] = iGrid[j][l];
-                 		//cout << iGridSlice[(k*iActualColumnCount)+l] << "\t";
-                  	}
-                  	//cout << endl;
-                }
-
-                //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-
-                // Sending the buffer to the last process
-                MPI_Send(iGridSlice, iSizeOfTheBuffer, MPI_INT, i, 1, MPI_COMM_WORLD);
-			}            
-
-            // Rest of the other processes (1 to n-1) will avail the chunk size partioning only.
-            else 
-            {
-            	// Calculating the starting and end index for each processes
-				iStartRowIndex = ((i * iChunkSize) + 1);
-				iEndRowIndex = iStartRowIndex + iChunkSize;
-				
-				// Adding outer layer into consideration
-				iStartRowIndex -= 1;
-				iEndRowIndex += 1;
-
-                // Initialzing the grid slice which needs to be passed via MPI Send
-                int iSizeOfTheRow = iEndRowIndex - iStartRowIndex;
-              
-                // Calculate the buffer size
-                iSizeOfTheBuffer = iSizeOfTheRow * iActualColumnCount;
-
-                // Create a local copy
-				int *iGridSlice = new int[iSizeOfTheBuffer];
-
-                // Sending the size of the row
-                MPI_Send(&iSizeOfTheRow, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
-
-                //cout << "IF block for Process " << i << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-                //cout << "Start Row Index: " << iStartRowIndex << " | End Row Index: " << iEndRowIndex << endl;
-
-                for(int j = iStartRowIndex, k = 0; j < iEndRowIndex; j++, k++)
-                {
-                	for(int l = 0; l < iActualColumnCount; l++)
-            		{
-                 		iGridSlice[(k*iActualColumnCount)+l] = iGrid[j][l];
-                 		//cout << iGridSlice[(k*iActualColumnCount)+l] << "\t";
-                  	}
-                  	//cout << endl;
-                }
-
-                //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-
-                // Sending the buffer to the last process
-                MPI_Send(iGridSlice, iSizeOfTheBuffer, MPI_INT, i, 1, MPI_COMM_WORLD);
-			}
-        }
-	}
+		// Calculating the starting and end index for processes 0
+		iStartRowIndex = ((0 * iChunkSize) + 1);
+		iEndRowIndex = iStartRowIndex + iChunkSize;
 
-	// Done reading from the file
-	fInput.close();
+		// Adding outer layer into consideration
+		iStartRowIndex -= 1;
+		iEndRowIndex += 1;
 
-	// Let all the processes get synchronized
-    MPI_Barrier(MPI_COMM_WORLD);
+		for(int i = 1; i < world_size; i++) 
+        {
+        	// Calculating the starting and end index for each processes
+			int iSliceStartIndex = ((i * iChunkSize) + 1);
+			int iSliceEndIndex = iSliceStartIndex + iChunkSize;
 
-    // Receiving the size of row first
-    MPI_Recv(&iRowCount, 1, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+			// Last process will avail the chuck size and the remainder
+			if(i == (world_size - 1))
+				iSliceEndIndex += iChunkRemainder;
 
-	// Calculate the buffer size (for each process)
-    int iSizeOfTheBuffer = iRowCount * iActualColumnCount;
+			// Adding outer layer into consideration
+			iSliceStartIndex -= 1;
+			iSliceEndIndex += 1;
 
-    // Create a local copy
-	int *iGridLocal = new int[iSizeOfTheBuffer];
-	int *iGridFinalLocal = new int[iRowCount*(iActualColumnCount - 2)];
+            // Initialzing the grid slice which needs to be passed via MPI Send
+            int iSizeOfTheRow = iSliceEndIndex - iSliceStartIndex;
 
-	// Let all the processes get synchronized
-    MPI_Barrier(MPI_COMM_WORLD);
+            // Calculate the buffer size (in packed words, the rows are contiguous)
+            int iSizeOfTheBuffer = iSizeOfTheRow * grid.iStride;
 
-	// Time to receive the slice grids
-    MPI_Recv(iGridLocal, iSizeOfTheBuffer, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            // Sending the size of the row
+            MPI_Send(&iSizeOfTheRow, 1, MPI_INT, i, 1, MPI_COMM_WORLD);
 
-	//cout << "Process: " << world_rank << " | Number of Rows: " << iRowCount << " | Number of Columns: " << iActualColumnCount << " | Buffer Size: " << iSizeOfTheBuffer << endl;
-	
-	// Now, create two grids for generations.
-	allocateGrids(iRowCount, iActualColumnCount);
+            // Sending the slice straight out of the grid to the process
+            MPI_Send(getRow(grid, iSliceStartIndex), iSizeOfTheBuffer, MPI_UINT64_T, i, 1, MPI_COMM_WORLD);
+        }
+        cout << "Task distribution send completed.." << endl;
+	}
+	else
+	{
+	    // Receiving the size of row first
+	    MPI_Recv(&iRowCount, 1, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-	// Let all the processes get synchronized
-    MPI_Barrier(MPI_COMM_WORLD);
+		// Now, create two grids for generations.
+		allocateGrids(iRowCount, iActualColumnCount);
 
-	// Assigning 1D array values to 2D above created array
-	int iTempIndex = 0;
-	for(int i = 0; i < iRowCount; i++)
-	{
-		for(int j = 0; j < iActualColumnCount; j++)
-		{
-			iGrid[i][j] = iGridNew[i][j] = iGridLocal[iTempIndex];
-			iTempIndex += 1;
-			//cout << iGrid[i][j] << " ";
-		}
-		//cout << endl;
+		// Calculate the buffer size (for each process)
+	    int iSizeOfTheBuffer = iRowCount * grid.iStride;
+
+		// Time to receive the slice straight into the grid
+	    MPI_Recv(getRow(grid, 0), iSizeOfTheBuffer, MPI_UINT64_T, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+		copyGrid(gridNew, grid);
 	}
 
-	//cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+	if(world_rank == 0)
+		iRowCount =  iEndRowIndex - iStartRowIndex;
+
+	cout << "Process " << world_rank << endl;
+	cout << "Row Index Starts: 1 | Row Index Ends: " << (iRowCount - 1) << " | Column Starts: 1 | Column Ends: " << (iActualColumnCount - 1) << endl;  
+
+	// Neighbouring processes of the ring
+	int iUpperRank = ((world_rank - 1) + world_size) % world_size;
+	int iLowerRank = ((world_rank + 1) + world_size) % world_size;
+
+	// The halos travel as whole packed rows, straight between the grids
+	MPI_Datatype rowType = createRowType(grid);
 
 	// All set for the game
 	for(int iSteps = 1; iSteps <= iGenerations; iSteps++)
 	{
-		for(int i = 1; i < (iRowCount - 1); i++)
-			for(int j = 1; j < (iActualColumnCount - 1); j++)
-				iGridNew[i][j] = adjacentNeighbors(i, j);
-	
-		// Time to create a copy of the new generated state to the older one
-		// as a reference to create the newer one in the next generation
-		copyGrid(iRowCount, iActualColumnCount);
+		// Let all the processes get synchronized
+    	MPI_Barrier(MPI_COMM_WORLD);
+
+    	if(iSteps != 1) // Performing halo exchange from 2nd generation onwards
+    	{
+    		// Own rows get their left and right layers before they are sent
+    		addOuterColumns(grid, 1, iRowCount - 1);
+
+			// Bottom halo exchange
+			// For example, bottow row of Process 0 will be transferred to the top row of Process 1
+			MPI_Sendrecv(getRow(grid, iRowCount-2), 1, rowType, iLowerRank, 1,
+                getRow(grid, 0), 1, rowType, iUpperRank, 1,
+                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+			// Top halo exchange
+			// For example, top row of Process 1 will be transferred to the bottom row of Process 0
+    		MPI_Sendrecv(getRow(grid, 1), 1, rowType, iUpperRank, 2,
+                getRow(grid, iRowCount-1), 1, rowType, iLowerRank, 2,
+                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+			// The received rows come with their left and right layers, the diagonals included
+			cout << "Halo exchange successfully done for Process " << world_rank << endl;
+    	}
+
+		// Iteration through row, 64 cells of the row at once
+		nextGeneration(grid, gridNew, 1, iRowCount - 1);
+
+		// The new generated state becomes the reference to create the newer one
+		// in the next generation: only the grids are swapped, nothing is copied
+		swapGrids(grid, gridNew);
 	}
 
-	// Let all the processes get synchronized
-    MPI_Barrier(MPI_COMM_WORLD);
-
-	// Copy the final copy to a 1D array for sending it to 
+	// Send the final copy (without the top and bottom layer) to process 0
 	if(world_rank)
 	{
-		//cout << "Process " << world_rank << " final copy." << endl;
-		iTempIndex = 0;
-		for(int i = 1; i < (iRowCount - 1); i++)
-		{
-			for(int j = 1; j < (iActualColumnCount - 1); j++)
-			{
-				iGridFinalLocal[iTempIndex] = iGrid[i][j];
-				//cout << iGridFinalLocal[iTempIndex] << " ";
-				iTempIndex += 1;
-			}
-		}
-
 		// Sending the size of the row
 		iRowCount = iRowCount - 2;
         MPI_Send(&iRowCount, 1, MPI_INT, 0, 1, MPI_COMM_WORLD);
 
-        //cout << "Process: " << world_rank << " | Row Size: " << iRowCount << " | Buffer Size: " <<  iTempIndex << endl;
-        // Sending the buffer to process 0
-        MPI_Send(iGridFinalLocal, iTempIndex, MPI_INT, 0, 1, MPI_COMM_WORLD);
-	
-        //cout << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+        // Sending the rows straight out of the grid to process 0
+        MPI_Send(getRow(grid, 1), iRowCount * grid.iStride, MPI_UINT64_T, 0, 1, MPI_COMM_WORLD);
 	}
 	
 
 	// Write the final state to the file
 	else    
 	{
-
-		cout << "Process 0" << endl;
+		cout << "Job done, writing to the file." << endl;
 		// First process 0 will write its own result to the file
+		cout << "Process 0" << endl;
 		for(int i = 1; i < (iRowCount - 1); i++)
 		{
 			for(int j = 1; j < (iActualColumnCount - 1); j++)
-			{
-				cout << iGrid[i][j]  << " "; 
-				fOutput << iGrid[i][j] << " ";
-			}
+				fOutput << getCell(grid, i, j) << " ";
 			fOutput << endl;
-			cout << endl;
 		}
 
 		// Last, time  other processes' result
@@ -408,35 +280,55 @@ int main(int argc, char *argv[])
 	    {
 	    	// Receiving the size of row first
     		MPI_Recv(&iRowCount, 1, MPI_INT, i, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-	    	
-    		int* iGridFinaLocalCopy = new int[iRowCount * (iActualColumnCount - 2)];
+
+    		// The slice is received into a grid of its own
+    		LifeGrid gridFinalCopy;
+    		allocateGrid(gridFinalCopy, iRowCount, iActualColumnCount);
 
     		// Time to receive the final copy from other process
-    		MPI_Recv(iGridFinaLocalCopy, (iRowCount * (iActualColumnCount - 2)), MPI_INT, i, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    		MPI_Recv(getRow(gridFinalCopy, 0), (iRowCount * gridFinalCopy.iStride), MPI_UINT64_T, i, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
     		cout << "Process " << i << endl;
 
 			// Writing to file
-			for(int i = 0; i < (iRowCount * (iActualColumnCount - 2)); i++)
+			for(int j = 0; j < iRowCount; j++)
 			{
-				if(i % (iActualColumnCount - 2) == 0 && i != 0)
-				{
-					fOutput << endl;
-					cout << endl;
-				}
-				fOutput << iGridFinaLocalCopy[i] << " ";
-				cout << iGridFinaLocalCopy[i] << " ";
+				for(int k = 1; k < (iActualColumnCount - 1); k++)
+					fOutput << getCell(gridFinalCopy, j, k) << " ";
+				fOutput << endl;
 			}
-			fOutput << endl;
-			cout << endl;
+
+			// free the received grid
+			freeGrid(gridFinalCopy);
 		}
+
+		// Measure the ending clock time
+        dEndTime = MPI_Wtime();
+		
+		// Calculate the time of the program
+        cout << "Execution time: " << dEndTime - dStartTime << endl;
+
+        cout << "\n\nProgram Configuration" << endl;
+        cout << "Grid Size: " <<  iActualRowCount-2 << " * " << iActualColumnCount-2 << endl;
+        cout << "Processes: " << world_size << endl;
+        cout << "Number of generations: " << iGenerations << endl; 
+        cout << "Kernel: " << getRowKernelName() << endl;
 		cout << "Last generation output has been written to file." << endl;
 	}
 
+	// Free the datatype and the grids
+	MPI_Type_free(&rowType);
+	freeGrid(grid);
+	freeGrid(gridNew);
+
+	// Done reading from the file
+	fInput.close();
+
 	// Done writing to the file
 	fOutput.close();
 
 	// Finalize the MPI environment.
     MPI_Finalize();
+
 	return 0;
-}
\ No newline at end of file
+}
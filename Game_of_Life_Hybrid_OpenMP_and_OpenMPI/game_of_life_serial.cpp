@@ -10,8 +10,23 @@
  * Any live cell with two or three live neighbours lives on to the next generation.
  * Any dead cell with exactly three live neighbours becomes a live cell.
  *
+ * Any other Life-like rule is given with --rule in B/S notation or by its name (life_rule.h).
+ *
+ * The grid wraps around as a torus unless --boundary makes its edges dead or lets it grow
+ * with the pattern as a window onto the unbounded plane (life_bounds.h).
+ *
+ * With --snapshot the run is a batch: instead of printing every generation, every iSnapshotEvery-th
+ * generation goes to a snapshot stream, encoded and written in the background (life_stream.h).
+ *
+ * The input may be an RLE pattern (life_rle.h), which brings its rule along unless --rule is given;
+ * the last generation is written as one when the name of the output ends in ".rle".
+ *
+ * With --stats every generation writes its population, births, deaths, bounding box and hash
+ * on a line of the statistics file; --stop-on-cycle ends the run at the first still life or
+ * oscillation of a period up to --cycle-period (life_stats.h).
+ *
  * @author Md. Ahsan Ayub
- * @version 1.1 04/02/2019 
+ * @version 1.9 10/17/2026 
  *
  */
 
@@ -19,111 +34,47 @@
 #include <string>
 #include <fstream>
 #include <stdlib.h>
+#include <string.h>
+
+// Including the bit-packed grid, its kernel and the binary grid file
+#include "life_grid.h"
+#include "life_kernel.h"
+#include "life_file.h"
+#include "life_bounds.h"
+#include "life_stream.h"
+#include "life_rle.h"
+#include "life_stats.h"
 
 using namespace std;
 
 // Declaring global grid array
-int **iGrid;
-int **iGridNew;
+LifeGrid grid;
+LifeGrid gridNew;
 
 // Actial values will be initialized after knowing the user defined grid dimension
 int iActualRowCount = 0, iActualColumnCount = 0;
 
+// Rows and columns of the outer layers: the radius of the neighbourhood
+int iDepth = 1;
+
 // Allocate the arrays
 void allocateGrids()
 {
-	iGrid = new int*[iActualRowCount];
-	iGridNew = new int*[iActualRowCount]; // A copy of iGrid
-	for (int i = 0; i < iActualRowCount; i++)
-	{
-		iGrid[i] = new int[iActualColumnCount];
-		iGridNew[i] = new int[iActualColumnCount];
-	}
+	allocateGrid(grid, iActualRowCount, iActualColumnCount);
+	allocateGrid(gridNew, iActualRowCount, iActualColumnCount); // A copy of grid
 }
 
-// Add outer layers to the grid
-void addOuterLayers()
-{
-	// Add top layer which is the copy of the iRowCount th stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[0][i] = iGrid[iActualRowCount - 2][i];
-
-	// Add bottom layer which is the copy of the 1 st stride row-wise.
-	for(int i = 1; i <= (iActualColumnCount - 2); i++)
-		iGrid[iActualRowCount - 1][i] = iGrid[1][i];
-
-	// Add left layer which is the copy of the iColumnCount st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][0] = iGrid[i][iActualColumnCount - 2];
-
-	// Add right layer which is the copy of the 1 st stride column-wise.
-	for(int i = 1; i <= (iActualRowCount - 2); i++)
-		iGrid[i][iActualColumnCount-1] = iGrid[i][1];
-
-	// Diagonal copies
-	iGrid[0][0] = iGrid[iActualRowCount - 2][iActualColumnCount - 2];	// Upper Left
-	iGrid[0][iActualColumnCount - 1] = iGrid[iActualRowCount - 2][1];	// Upper Right
-	iGrid[iActualRowCount - 1][0] = iGrid[1][iActualColumnCount - 2];	// Lower Left
-	iGrid[iActualRowCount - 1][iActualColumnCount - 1] = iGrid[1][1];	// Lower Right
-}
-
-// Print routine of iGrid
+// Print routine of grid
 void printGrid(int iRowCountStart, int iRowCountEnd, int iColumnCountStart, int iColumnCountEnd)
 {
 	for(int i = iRowCountStart; i < iRowCountEnd; i++)
 	{
 		for(int j = iColumnCountStart; j < iColumnCountEnd; j++)
-			cout << iGrid[i][j] << "\t";
+			cout << getCell(grid, i, j) << "\t";
 		cout << endl;
 	}
 }
 
-
-// Copy routine to iGrid from iGridNew (to make a new state's copy)
-void copyGrid()
-{
-	for(int i = 0; i < iActualRowCount; i++)
-		for(int j = 0; j < iActualColumnCount; j++)
-			iGrid[i][j] = iGridNew[i][j];
-}
-
-// Measure the neighbors' status of a particular cell
-int adjacentNeighbors(int i, int j)
-{
-	// Variables to calculate the number of alive and dead cells
-	int iAliveCount = 0, iDeadCount = 0;
-
-	iGrid[i - 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i - 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j + 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i + 1][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-	iGrid[i][j - 1] == 0 ? iDeadCount++ : iAliveCount++;
-
-	if(iAliveCount < 2)
-		// A cell dies of loneliness
-		return 0;
-
-	else if(iAliveCount > 3)
-		// A cell dies of overcrowding
-		return 0;
-
-	else if(iGrid[i][j] == 1 && (iAliveCount == 2 || iAliveCount == 3))
-		// Current cell is alive, and there are TWO (which will become three in total) and exactly THREE cells alive.
-		// Thus, the cell survives.s
-		return 1;
-
-	else if(iGrid[i][j] == 0 && iAliveCount == 3)
-		// Current cell is NOT alive; however, there are exactly THREE alive cells: thus, the cell is born.
-		return 1;
-	
-	else
-		// Very unlikely this will be executed
-		return 0;
-}
-
 // Add an outer layer of the whole array for the simplicity
 
 // Main function
@@ -132,10 +83,59 @@ int main(int argc, char *argv[])
 	// Checking the number of input has to be passed by the user
 	if (argc < 3)
     {
-        printf("Usuage: ./<executable> <input_file> <iterations> <output_file>\n");
+        printf("Usuage: ./<executable> <input_file> <iterations> <output_file> [--rule B<counts>/S<counts>|<name>] [--boundary torus|dead|grow] [--snapshot <file> [--snapshot-every <generations>]] [--stats <file>] [--cycle-period <generations>] [--stop-on-cycle]\n");
         return -1;
     }
 
+    // Optional arguments: the rule of the game, the boundaries of the grid, the snapshot stream and the statistics
+    LifeRule rule;
+    LifeBoundary boundary = LIFE_BOUNDARY_TORUS;
+    const char *sSnapshotFile = NULL, *sStatsFile = NULL;
+    int iSnapshotEvery = 1, iRuleGiven = 0;
+    int iCyclePeriod = LIFE_CYCLE_PERIOD, iStopOnCycle = 0;
+    createRule(rule);
+    for(int i = 4; i < argc; i++)
+    {
+    	if(strcmp(argv[i], "--rule") == 0 && i + 1 < argc && parseRule(rule, argv[i + 1]))
+    	{
+    		i++;
+    		iRuleGiven = 1;
+    	}
+    	else if(strcmp(argv[i], "--boundary") == 0 && i + 1 < argc && parseBoundary(boundary, argv[i + 1]))
+    		i++;
+    	else if(strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+    		sSnapshotFile = argv[++i];
+    	else if(strcmp(argv[i], "--snapshot-every") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+    		iSnapshotEvery = atoi(argv[++i]);
+    	else if(strcmp(argv[i], "--stats") == 0 && i + 1 < argc)
+    		sStatsFile = argv[++i];
+    	else if(strcmp(argv[i], "--cycle-period") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+    		iCyclePeriod = atoi(argv[++i]);
+    	else if(strcmp(argv[i], "--stop-on-cycle") == 0)
+    		iStopOnCycle = 1;
+    	else
+    	{
+    		printf("Usuage: ./<executable> <input_file> <iterations> <output_file> [--rule B<counts>/S<counts>|<name>] [--boundary torus|dead|grow] [--snapshot <file> [--snapshot-every <generations>]] [--stats <file>] [--cycle-period <generations>] [--stop-on-cycle]\n");
+    		return -1;
+    	}
+    }
+
+    // An RLE pattern brings its rule along
+    LifeRle rle;
+    int iRleInput = isRleFile(argv[1]);
+    if(iRleInput)
+    {
+    	if(!openRle(rle, argv[1]))
+    		return -1;
+    	if(!iRuleGiven && rle.sRule[0] && !parseRule(rule, rle.sRule))
+    	{
+    		printf("The rule %s of the input file is not supported.\n", rle.sRule);
+    		return -1;
+    	}
+    }
+    setKernelRule(rule);
+    iDepth = rule.iRadius;
+
     // Getting values from the argument
     ifstream fInput(argv[1]);
     int iGenerations = atoi(argv[2]);
@@ -149,76 +149,267 @@ int main(int argc, char *argv[])
 	}
 
 	// Initializing necessary variables
-	int iRowCount, iColumnCount, iNeighborStatus;
+	int iRowCount, iColumnCount;
 	char cItem;
+	uint64_t uGeneration = 0;
+	long long lRowOrigin = 0, lColumnOrigin = 0;
 
-	// Getting the grid dimension from the first line of the input file
-	fInput >> iRowCount >> iColumnCount;
-	iActualRowCount = iRowCount + 2; // Two new layers will be added: Top and Bottom
-	iActualColumnCount = iColumnCount + 2; // Two new layers will be added: Left and Right
+	// A binary grid file is unpacked straight from its memory mapping
+	if(isLifeFile(argv[1]))
+	{
+		LifeFile fileGrid;
+		if(!openLifeFile(fileGrid, argv[1]))
+			return -1;
+
+		iRowCount = (int) fileGrid.header.uRowCount;
+		iColumnCount = (int) fileGrid.header.uColumnCount;
+		uGeneration = fileGrid.header.uGeneration;
+		iActualRowCount = iRowCount + 2 * iDepth; // New layers will be added: Top and Bottom
+		iActualColumnCount = iColumnCount + 2 * iDepth; // New layers will be added: Left and Right
 
-	// Allocate 2D arrays dynamically
-	allocateGrids();
+		// Allocate 2D arrays dynamically
+		allocateGrids();
 
-	// Populating the array from file
-	int iCounterRow = 1, iCounterColumn = 1; // Ignoring 0 indexes, as it will later be added as outer layers!
-	while(fInput >> cItem)
+		if(checksumRows(fileGrid, 0, iRowCount) != fileGrid.header.uChecksum)
+		{
+			printf("The checksum of the input file does not match its grid.\n");
+			return -1;
+		}
+		readRows(fileGrid, grid, iDepth, iDepth, 0, iRowCount, 0, iColumnCount);
+		closeLifeFile(fileGrid);
+	}
+	else if(iRleInput)
 	{
-		// Condition to always maintain the correct index order of the 2D array
-		if(iCounterColumn > iColumnCount)
+		// The runs of an RLE pattern go straight into the grid. A growing grid starts with the live cells only,
+		// so a few of them in a huge world take no room (a single dead cell if there are none).
+		int iBounds[4] = { 0, rle.iRowCount, 0, rle.iColumnCount };
+		if(boundary == LIFE_BOUNDARY_GROW && !findRleBounds(rle, iBounds))
 		{
-			iCounterRow++;
-			iCounterColumn = 1;
+			iBounds[0] = iBounds[2] = 0;
+			iBounds[1] = iBounds[3] = 1;
 		}
 
-		//cout << cItem << "\n";
-		iGrid[iCounterRow][iCounterColumn] = cItem - '0';
-		//cout << "Row: " << iCounterRow << " , Column: " << (iCounterColumn % iColumnCount) << endl;
-		iCounterColumn++;
+		iRowCount = iBounds[1] - iBounds[0];
+		iColumnCount = iBounds[3] - iBounds[2];
+		uGeneration = rle.uGeneration;
+		lRowOrigin = rle.lRowOrigin + iBounds[0];
+		lColumnOrigin = rle.lColumnOrigin + iBounds[2];
+		iActualRowCount = iRowCount + 2 * iDepth; // New layers will be added: Top and Bottom
+		iActualColumnCount = iColumnCount + 2 * iDepth; // New layers will be added: Left and Right
+
+		// Allocate 2D arrays dynamically
+		allocateGrids();
+
+		if(!readRleCells(rle, grid, iDepth, iDepth, iBounds[0], iRowCount, iBounds[2], iColumnCount))
+			return -1;
+		closeRle(rle);
+	}
+	else
+	{
+		// Getting the grid dimension from the first line of the input file
+		fInput >> iRowCount >> iColumnCount;
+		iActualRowCount = iRowCount + 2 * iDepth; // New layers will be added: Top and Bottom
+		iActualColumnCount = iColumnCount + 2 * iDepth; // New layers will be added: Left and Right
+
+		// Allocate 2D arrays dynamically
+		allocateGrids();
+
+		// Populating the array from file
+		int iCounterRow = iDepth, iCounterColumn = iDepth; // Ignoring the first indexes, as they will later be added as outer layers!
+		while(fInput >> cItem)
+		{
+			// Condition to always maintain the correct index order of the 2D array
+			if(iCounterColumn >= iColumnCount + iDepth)
+			{
+				iCounterRow++;
+				iCounterColumn = iDepth;
+			}
+
+			//cout << cItem << "\n";
+			setCell(grid, iCounterRow, iCounterColumn, cItem - '0');
+			//cout << "Row: " << iCounterRow << " , Column: " << (iCounterColumn % iColumnCount) << endl;
+			iCounterColumn++;
+		}
 	}
 
 	// Done reading from the file
 	fInput.close();
 
-	// As the file has read properly, now it's time to add outer layers
-	addOuterLayers();
+	// The outer layers are copies of the cells, as deep as the neighbourhood
+	if(boundary == LIFE_BOUNDARY_TORUS && (iRowCount < iDepth || iColumnCount < iDepth))
+	{
+		printf("The grid needs at least %d rows and columns for the rule.\n", iDepth);
+		return -1;
+	}
+
+	// As the file has read properly, now it's time to add outer layers (dead ones beyond dead edges)
+	if(boundary == LIFE_BOUNDARY_TORUS)
+		addDeepOuterLayers(grid, iDepth);
 
-	// Print the grid before going into the generations
-	cout << "===== Given State =====" << endl;
-	printGrid(1, iRowCount + 1, 1, iColumnCount + 1);
+	// A growing grid starts as the window of the input onto the plane, with room for the live cells to spread
+	LifeWindow window;
+	createWindow(window, grid, iDepth, iDepth);
+	window.lRowOrigin = lRowOrigin;
+	window.lColumnOrigin = lColumnOrigin;
+	if(boundary == LIFE_BOUNDARY_GROW && fitWindow(window, grid, gridNew))
+	{
+		iRowCount = grid.iRowCount - 2 * iDepth;
+		iColumnCount = grid.iColumnCount - 2 * iDepth;
+	}
+
+	// The snapshots start with the given state
+	LifeStream stream;
+	if(sSnapshotFile)
+	{
+		if(!openStream(stream, sSnapshotFile, iSnapshotEvery, uGeneration))
+			return -1;
+		streamGrid(stream, grid, iDepth, uGeneration, window.lRowOrigin, window.lColumnOrigin);
+	}
+	else
+	{
+		// Print the grid before going into the generations
+		cout << "===== Given State =====" << endl;
+		printGrid(iDepth, iRowCount + iDepth, iDepth, iColumnCount + iDepth);
+	}
+
+	// The statistics of the generations are counted by the kernel, starting with the given state
+	LifeStats stats;
+	LifeCycle cycle;
+	FILE *pStats = NULL;
+	int iCounting = (sStatsFile != NULL) || iStopOnCycle;
+	if(iCounting)
+	{
+		if(sStatsFile && (pStats = fopen(sStatsFile, "w")) == NULL)
+		{
+			printf("Unable to write the statistics to %s.\n", sStatsFile);
+			return -1;
+		}
+		createStats(stats, grid, iDepth, iRowCount + iDepth, iDepth, iColumnCount + iDepth,
+					window.lRowOrigin - iDepth, window.lColumnOrigin - iDepth, 1, uGeneration);
+		createCycle(cycle, iCyclePeriod);
+		findCycle(cycle, stats.generation);
+		if(pStats)
+		{
+			writeStatsHeader(pStats);
+			writeGeneration(pStats, stats.generation);
+		}
+	}
 
 	// All set for the game
 	for(int iSteps = 1; iSteps <= iGenerations; iSteps++)
 	{
-		for(int i = 1; i <= iRowCount; i++)
+		// 64 cells of a row are computed at once, and counted while they are in cache
+		if(iCounting)
+			nextGenerationCounted(stats, grid, gridNew, iDepth, iRowCount + iDepth);
+		else
+			nextGeneration(grid, gridNew, iDepth, iRowCount + iDepth);
+
+		// The new generated state becomes the reference to create the newer one
+		// in the next generation: only the grids are swapped, nothing is copied
+		swapGrids(grid, gridNew);
+		if(boundary == LIFE_BOUNDARY_TORUS)
+			addDeepOuterLayers(grid, iDepth);
+		else
+			clearOuterLayers(grid, iDepth);
+
+		// A generation closing a cycle ends the run when asked to
+		if(iCounting)
 		{
-			for(int j = 1; j <= iColumnCount; j++)
+			finishStats(stats, grid);
+			if(pStats)
+				writeGeneration(pStats, stats.generation);
+			if(findCycle(cycle, stats.generation) && iStopOnCycle)
+				iGenerations = iSteps;
+		}
+
+		// The window follows the live cells before they can reach its edges
+		if(boundary == LIFE_BOUNDARY_GROW && iSteps % window.iCheckEvery == 0 && fitWindow(window, grid, gridNew))
+		{
+			iRowCount = grid.iRowCount - 2 * iDepth;
+			iColumnCount = grid.iColumnCount - 2 * iDepth;
+
+			// The cells are counted again in the moved window, their hash stays as it is a sum over the plane
+			if(iCounting)
 			{
-				iGridNew[i][j] = adjacentNeighbors(i, j);
+				LifeGeneration generation = stats.generation;
+				freeStats(stats);
+				createStats(stats, grid, iDepth, iRowCount + iDepth, iDepth, iColumnCount + iDepth,
+							window.lRowOrigin - iDepth, window.lColumnOrigin - iDepth, 1, uGeneration + iSteps);
+				stats.generation.lBirths = generation.lBirths;
+				stats.generation.lDeaths = generation.lDeaths;
 			}
 		}
-		// Time to create a copy of the new generated state to the older one
-		// as a reference to create the newer one in the next generation
-		copyGrid();
+
+		// The writer takes care of the snapshot, the next generation goes on at once
+		if(sSnapshotFile)
+		{
+			if(isFrameDue(stream, uGeneration + iSteps))
+				streamGrid(stream, grid, iDepth, uGeneration + iSteps, window.lRowOrigin, window.lColumnOrigin);
+			continue;
+		}
 
 		cout << "+++++ Generation " << iSteps << " +++++" << endl;
 		
 		// Print the new generation state
-		printGrid(1, iRowCount + 1, 1, iColumnCount + 1);
+		printGrid(iDepth, iRowCount + iDepth, iDepth, iColumnCount + iDepth);
+	}
+
+	// The frames still queued are written before the program ends
+	if(sSnapshotFile)
+	{
+		int iWritten = closeStream(stream);
+		cout << "Snapshots: " << stream.iFrameCount << " frames, " << stream.lBytesWritten << " bytes (waited for the writer "
+			 << stream.iWaitCount << " times)" << endl;
+		if(!iWritten)
+		{
+			printf("Error writing the snapshot stream.\n");
+			return -1;
+		}
 	}
 
-	// Write the final state to the 
-	for(int i = 1; i <= iRowCount; i++)
+	// Write the final state to the binary grid file (a file name ending in ".bin"), as an RLE pattern (".rle") or as text
+	size_t iNameLength = strlen(argv[3]);
+	if(iNameLength >= 4 && strcmp(argv[3] + iNameLength - 4, ".bin") == 0)
+		writeLifeFile(argv[3], grid, iDepth, uGeneration + iGenerations);
+	else if(isRleOutput(argv[3]))
+		writeRleFile(argv[3], grid, iDepth, rule, uGeneration + iGenerations, window.lRowOrigin, window.lColumnOrigin);
+	else
 	{
-		for (int j = 1; j <= iColumnCount; j++)
-			fOutput << iGrid[i][j] << " ";
+		for(int i = iDepth; i < iRowCount + iDepth; i++)
+		{
+			for (int j = iDepth; j < iColumnCount + iDepth; j++)
+				fOutput << getCell(grid, i, j) << " ";
 
-		fOutput << endl;
+			fOutput << endl;
+		}
 	}
 
 	cout << "Last generation output has been written to file." << endl;
+	if(iCounting)
+	{
+		if(cycle.iPeriod)
+			cout << "Cycle of period " << cycle.iPeriod << " closed at generation " << cycle.uGeneration
+				 << (iStopOnCycle ? ", the run stopped there" : "") << endl;
+		else
+			cout << "No cycle of a period up to " << iCyclePeriod << " found" << endl;
+		cout << "Population: " << stats.generation.lPopulation << endl;
+		if(pStats)
+			fclose(pStats);
+		freeStats(stats);
+		freeCycle(cycle);
+	}
+	if(boundary == LIFE_BOUNDARY_GROW)
+	{
+		cout << "Window: rows " << window.lRowOrigin << " .. " << window.lRowOrigin + iRowCount - 1 << ", columns "
+			 << window.lColumnOrigin << " .. " << window.lColumnOrigin + iColumnCount - 1 << endl;
+		cout << "Window resized " << window.iResizeCount << " times, largest " << window.lLargestCells << " cells" << endl;
+	}
 	// Done writing to the file
 	fOutput.close();
 
+	// Free the grids
+	freeGrid(grid);
+	freeGrid(gridNew);
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,287 @@
+/*
+ * The activity of the tiles of a bit-packed grid.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the activity of the tiles
+#include "life_activity.h"
+
+// Mask of the cells of word w lying in the columns iLow .. iHigh
+static LifeWord columnMask(int w, int iLow, int iHigh)
+{
+	iLow -= w * LIFE_WORD_BITS;
+	iHigh -= w * LIFE_WORD_BITS;
+	if(iLow < 0)
+		iLow = 0;
+	if(iHigh > LIFE_WORD_BITS - 1)
+		iHigh = LIFE_WORD_BITS - 1;
+	if(iHigh < iLow)
+		return 0;
+
+	return (~(LifeWord) 0 >> (LIFE_WORD_BITS - 1 - iHigh)) & (~(LifeWord) 0 << iLow);
+}
+
+// Words of the row i holding cells of the halos: [0, iLeftEnd) and [iRightStart, iWordCount), all of them in the top and
+// bottom halos
+static void haloWords(const LifeActivity &activity, const LifeGrid &grid, int i, int &iLeftEnd, int &iRightStart)
+{
+	if(i < activity.iHaloCells || i >= grid.iRowCount - activity.iHaloCells)
+	{
+		iLeftEnd = iRightStart = grid.iWordCount;
+		return;
+	}
+
+	iLeftEnd = (activity.iHaloCells - 1) / LIFE_WORD_BITS + 1;
+	iRightStart = (grid.iColumnCount - activity.iHaloCells) / LIFE_WORD_BITS;
+	if(iLeftEnd > grid.iWordCount)
+		iLeftEnd = grid.iWordCount;
+	if(iRightStart < iLeftEnd)
+		iRightStart = iLeftEnd;
+}
+
+// Mark the tile (i, j) and its eight neighbours
+static void markNear(const LifeActivity &activity, unsigned char *cNear, int i, int j)
+{
+	for(int k = i - 1; k <= i + 1; k++)
+		for(int l = j - 1; l <= j + 1; l++)
+			if(k >= 0 && k < activity.iTileRowCount && l >= 0 && l < activity.iTileColumnCount)
+				cNear[k * activity.iTileColumnCount + l] = 1;
+}
+
+// Set up the tiles of the grid for halos of iHaloCells rows and columns and a neighbourhood of iRadius cells, all tiles
+// count as changed to begin with
+void createActivity(LifeActivity &activity, const LifeGrid &grid, int iHaloCells, int iRadius)
+{
+	int iDepth = iHaloCells + iRadius - 1;
+	activity.iRowCount = grid.iRowCount;
+	activity.iWordCount = grid.iWordCount;
+	activity.iDepth = iDepth;
+	activity.iHaloCells = iHaloCells;
+	activity.iHaloWatched = (iHaloCells == iRadius);
+	activity.iHaloSaved = 0;
+	activity.iTileRowCount = (grid.iRowCount + LIFE_TILE_ROWS - 1) / LIFE_TILE_ROWS;
+	activity.iTileColumnCount = (grid.iWordCount + LIFE_TILE_WORDS - 1) / LIFE_TILE_WORDS;
+
+	int iTiles = activity.iTileRowCount * activity.iTileColumnCount;
+	activity.cRing = (unsigned char *) malloc(iTiles);
+	activity.cChanged = (unsigned char *) malloc(iTiles);
+	activity.cChangedNew = (unsigned char *) malloc(iTiles);
+	activity.iActive = (int *) malloc(iTiles * sizeof(int));
+	activity.cFull = (unsigned char *) malloc(iTiles);
+	activity.cNear = (unsigned char *) malloc(iTiles);
+	activity.cHaloNear = (unsigned char *) malloc(iTiles);
+	activity.iActiveCount = 0;
+	activity.lTileCount = 0;
+	activity.lRingCount = 0;
+	memset(activity.cChanged, 1, iTiles);
+	memset(activity.cNear, 1, iTiles);
+	memset(activity.cHaloNear, 1, iTiles);
+
+	// The cells of the halos of the exchange before are kept (the words holding them)
+	activity.iHaloWords = 0;
+	for(int i = 0; i < grid.iRowCount && activity.iHaloWatched; i++)
+	{
+		int iLeftEnd, iRightStart;
+		haloWords(activity, grid, i, iLeftEnd, iRightStart);
+		activity.iHaloWords += iLeftEnd + (grid.iWordCount - iRightStart);
+	}
+	activity.uHalo = (LifeWord *) malloc((activity.iHaloWords + 1) * sizeof(LifeWord));
+
+	// Tiles holding a cell up to iDepth rows or columns away from the halos
+	for(int i = 0; i < activity.iTileRowCount; i++)
+	{
+		int iFirstRow = i * LIFE_TILE_ROWS, iLastRow = iFirstRow + LIFE_TILE_ROWS - 1;
+		for(int j = 0; j < activity.iTileColumnCount; j++)
+		{
+			int iFirstColumn = j * LIFE_TILE_WORDS * LIFE_WORD_BITS, iLastColumn = iFirstColumn + LIFE_TILE_WORDS * LIFE_WORD_BITS - 1;
+			activity.cRing[i * activity.iTileColumnCount + j] = iFirstRow <= iDepth || iLastRow >= grid.iRowCount - 1 - iDepth ||
+																iFirstColumn <= iDepth || iLastColumn >= grid.iColumnCount - 1 - iDepth;
+		}
+	}
+}
+
+// Free the tiles
+void freeActivity(LifeActivity &activity)
+{
+	free(activity.cRing);
+	free(activity.cChanged);
+	free(activity.cChangedNew);
+	free(activity.iActive);
+	free(activity.cFull);
+	free(activity.cNear);
+	free(activity.cHaloNear);
+	free(activity.uHalo);
+}
+
+// A generation begins: the tiles which are not computed stay as they are
+void beginActivity(LifeActivity &activity)
+{
+	memset(activity.cChangedNew, 0, activity.iTileRowCount * activity.iTileColumnCount);
+}
+
+// The halos have arrived: mark the tiles next to the cells of the halos which changed since the exchange before. Halos good
+// for more than one generation are computed level by level in between, all tiles of the ring are marked then.
+void compareHalos(LifeActivity &activity, const LifeGrid &grid)
+{
+	int iTiles = activity.iTileRowCount * activity.iTileColumnCount;
+	memset(activity.cHaloNear, !activity.iHaloWatched || !activity.iHaloSaved, iTiles);
+	if(!activity.iHaloWatched)
+		return;
+
+	int iHaloCells = activity.iHaloCells, iLastColumn = grid.iColumnCount - 1;
+	LifeWord *uSaved = activity.uHalo;
+	for(int i = 0; i < grid.iRowCount; i++)
+	{
+		int iLeftEnd, iRightStart;
+		haloWords(activity, grid, i, iLeftEnd, iRightStart);
+		const LifeWord *uRow = getRow(grid, i);
+
+		// The words of the halos on the left, then on the right (none of them in the top and bottom halos)
+		for(int iPart = 0; iPart < 2; iPart++)
+		{
+			int iWordStart = iPart ? iRightStart : 0, iWordEnd = iPart ? grid.iWordCount : iLeftEnd;
+			for(int w = iWordStart; w < iWordEnd; w++, uSaved++)
+			{
+				LifeWord uMask = (iLeftEnd == grid.iWordCount) ? columnMask(w, 0, iLastColumn)
+															  : columnMask(w, 0, iHaloCells - 1) | columnMask(w, iLastColumn - iHaloCells + 1, iLastColumn);
+				if(activity.iHaloSaved && ((uRow[w] ^ *uSaved) & uMask))
+					markNear(activity, activity.cHaloNear, i / LIFE_TILE_ROWS, w / LIFE_TILE_WORDS);
+				*uSaved = uRow[w];
+			}
+		}
+	}
+	activity.iHaloSaved = 1;
+}
+
+// List the inner tiles, the ring or all tiles which changed or border a changed tile. The other tiles of the ring
+// next to a changed cell of the halos (compareHalos) are listed for the cells reading the halos only.
+int listActiveTiles(LifeActivity &activity, LifeTiles tiles)
+{
+	activity.iActiveCount = 0;
+
+	for(int i = 0; i < activity.iTileRowCount; i++)
+	{
+		for(int j = 0; j < activity.iTileColumnCount; j++)
+		{
+			int iTile = i * activity.iTileColumnCount + j;
+			if((tiles == LIFE_TILES_INNER && activity.cRing[iTile]) || (tiles == LIFE_TILES_RING && !activity.cRing[iTile]))
+				continue;
+
+			int iActive = activity.cNear[iTile];
+			if(iActive || (tiles == LIFE_TILES_RING && activity.cHaloNear[iTile]))
+			{
+				activity.cFull[activity.iActiveCount] = iActive;
+				activity.iActive[activity.iActiveCount++] = iTile;
+				if(iActive)
+					activity.lTileCount++;
+				else
+					activity.lRingCount++;
+			}
+		}
+	}
+
+	return activity.iActiveCount;
+}
+
+// Compute the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) into gridNew, the changes of their cells
+// valid at the level iLevel (those of the columns iLevel .. (iColumnCount - iLevel - 1)) are returned. The thread iThread
+// counts them into the statistics, if any.
+static LifeWord nextGenerationChanges(const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd, int iLevel,
+									  int iThread, LifeStats *stats)
+{
+	if(iRowStart >= iRowEnd || iWordStart >= iWordEnd)
+		return 0;
+
+	nextGenerationWords(grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+	if(stats)
+		scanStats(*stats, iThread, grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+
+	LifeWord uDifference = 0;
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		const LifeWord *uRow = getRow(grid, i), *uRowNew = getRow(gridNew, i);
+		for(int w = iWordStart; w < iWordEnd; w++)
+			uDifference |= (uRow[w] ^ uRowNew[w]) & columnMask(w, iLevel, grid.iColumnCount - iLevel - 1);
+	}
+	return uDifference;
+}
+
+// Compute the listed tiles of the level iLevel (valid on the rows iLevel .. (iRowCount - iLevel - 1)) into gridNew and
+// remember which of them changed. Called by all threads of a parallel region (after applySchedule), the listed tiles
+// are shared among them by the schedule of the run; the threads do not wait for each other at the end. The cells
+// computed are counted into the statistics of the thread iThread, if any: the cells of the other tiles are the same
+// in both grids.
+void nextGenerationTiles(LifeActivity &activity, const LifeGrid &grid, LifeGrid &gridNew, int iLevel, int iThread, LifeStats *stats)
+{
+	// Cells up to iDepth rows or columns away from the halos: the rows above iTopEnd and from iBottomStart on,
+	// the words before iLeftEnd and from iRightStart on
+	int iDepth = activity.iDepth;
+	int iTopEnd = iDepth + 1, iBottomStart = activity.iRowCount - iDepth - 1;
+	int iLeftEnd = iDepth / LIFE_WORD_BITS + 1, iRightStart = (grid.iColumnCount - iDepth - 1) / LIFE_WORD_BITS;
+
+	#pragma omp for schedule(runtime) nowait
+	for(int t = 0; t < activity.iActiveCount; t++)
+	{
+		int iTile = activity.iActive[t];
+		int iRowStart = (iTile / activity.iTileColumnCount) * LIFE_TILE_ROWS;
+		int iRowEnd = iRowStart + LIFE_TILE_ROWS;
+		int iWordStart = (iTile % activity.iTileColumnCount) * LIFE_TILE_WORDS;
+		int iWordEnd = iWordStart + LIFE_TILE_WORDS;
+
+		if(iRowStart < iLevel)
+			iRowStart = iLevel;
+		if(iRowEnd > activity.iRowCount - iLevel)
+			iRowEnd = activity.iRowCount - iLevel;
+		if(iWordEnd > activity.iWordCount)
+			iWordEnd = activity.iWordCount;
+
+		LifeWord uDifference;
+		if(activity.cFull[t])
+			uDifference = nextGenerationChanges(grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd, iLevel, iThread, stats);
+		else
+		{
+			// The rows next to the top and bottom halos, then the words of the other rows next to the left and right halos
+			int iMiddleStart = (iRowStart > iTopEnd) ? iRowStart : iTopEnd;
+			int iMiddleEnd = (iRowEnd < iBottomStart) ? iRowEnd : iBottomStart;
+			if(iMiddleStart > iRowEnd)
+				iMiddleStart = iRowEnd;
+			if(iMiddleEnd < iMiddleStart)
+				iMiddleEnd = iMiddleStart;
+
+			uDifference = nextGenerationChanges(grid, gridNew, iRowStart, iMiddleStart, iWordStart, iWordEnd, iLevel, iThread, stats);
+			uDifference |= nextGenerationChanges(grid, gridNew, iMiddleEnd, iRowEnd, iWordStart, iWordEnd, iLevel, iThread, stats);
+			uDifference |= nextGenerationChanges(grid, gridNew, iMiddleStart, iMiddleEnd, iWordStart, (iLeftEnd < iWordEnd) ? iLeftEnd : iWordEnd, iLevel, iThread, stats);
+
+			// The words next to the right halos start behind those next to the left ones, so no word is counted twice
+			int iRightFrom = (iRightStart > iLeftEnd) ? iRightStart : iLeftEnd;
+			uDifference |= nextGenerationChanges(grid, gridNew, iMiddleStart, iMiddleEnd, (iRightFrom > iWordStart) ? iRightFrom : iWordStart, iWordEnd, iLevel, iThread, stats);
+		}
+		activity.cChangedNew[iTile] = (uDifference != 0);
+	}
+}
+
+// The generation is done: its changes decide about the tiles of the next one
+void endActivity(LifeActivity &activity)
+{
+	unsigned char *cChanged = activity.cChanged;
+	activity.cChanged = activity.cChangedNew;
+	activity.cChangedNew = cChanged;
+
+	// Every changed tile marks itself and its eight neighbours (few tiles change in a sparse grid)
+	memset(activity.cNear, 0, activity.iTileRowCount * activity.iTileColumnCount);
+	for(int i = 0; i < activity.iTileRowCount; i++)
+	{
+		for(int j = 0; j < activity.iTileColumnCount; j++)
+		{
+			if(activity.cChanged[i * activity.iTileColumnCount + j])
+				markNear(activity, activity.cNear, i, j);
+		}
+	}
+}
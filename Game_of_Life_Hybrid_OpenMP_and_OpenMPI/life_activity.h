@@ -0,0 +1,77 @@
+/*
+ * The activity of the tiles of a bit-packed grid.
+ *
+ * The grid is cut into tiles of LIFE_TILE_ROWS rows by LIFE_TILE_WORDS words.
+ * Every tile remembers whether its cells changed in the last generation; only
+ * the tiles that changed or border a changed tile are computed, the other ones
+ * keep their cells. Those are already in the new grid as well: a tile that did
+ * not change holds the same cells in both grids, so swapping the grids needs no
+ * copy. The listed tiles are shared among the threads by the OpenMP loop of
+ * the run (schedule(runtime), life_schedule.h), as the tiles of a dense grid.
+ *
+ * The tiles of the ring (holding the cells up to iDepth rows or columns away
+ * from the halos) read the halos, which change behind the back of the tiles.
+ * After every exchange the halos are compared with those of the exchange before
+ * (compareHalos): the cells next to the halos are computed for the ring tiles
+ * next to a changed cell of the halos only, so a quiet edge (or a dead one)
+ * costs no more than a quiet inside. Deep halos are computed level by level
+ * between two exchanges, the cells next to them after every exchange anyway;
+ * only the cells still valid at a level count for the changes.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+#if !defined LIFE_ACTIVITY_H
+#define LIFE_ACTIVITY_H
+
+// Including the bit-packed grid
+#include "life_grid.h"
+#include "life_stats.h"
+
+// Rows and words of a tile (one cache line of each row)
+#define LIFE_TILE_ROWS 32
+#define LIFE_TILE_WORDS 8
+
+// Tiles to list: the inner ones (not reading the halos), the ring or all of them
+enum LifeTiles
+{
+	LIFE_TILES_INNER, LIFE_TILES_RING, LIFE_TILES_ALL
+};
+
+// Activity of the tiles of a grid
+struct LifeActivity
+{
+	int iTileRowCount;			// Tiles along the rows
+	int iTileColumnCount;		// Tiles along the words
+	int iRowCount;				// Rows of the grid
+	int iWordCount;				// Words of a row of the grid
+	int iDepth;					// Rows and columns of the ring reading the halos
+	int iHaloCells;				// Rows and columns of the halos
+	int iHaloWatched;			// The halos are good for a single generation, a ring tile whose halos did not change keeps its cells
+	int iHaloSaved;				// The halos of the exchange before are in uHalo
+	int iHaloWords;				// Words of the halos
+	LifeWord *uHalo;			// Cells of the halos at the exchange before, row by row
+	unsigned char *cRing;		// Tiles reading the halos
+	unsigned char *cHaloNear;	// Tiles next to a cell of the halos changed since the exchange before
+	unsigned char *cChanged;	// Tiles changed in the last generation
+	unsigned char *cChangedNew;	// Tiles changed in the generation being computed
+	unsigned char *cNear;		// Tiles changed in the last generation or bordering such a tile
+	int *iActive;				// Tiles listed to be computed
+	unsigned char *cFull;		// Listed tiles computed as a whole (or next to the halos only)
+	int iActiveCount;			// Number of the listed tiles
+	long lTileCount;			// Tiles computed as a whole so far
+	long lRingCount;			// Ring tiles computed next to the halos only so far
+};
+
+// Signature of the methods
+void createActivity(LifeActivity &activity, const LifeGrid &grid, int iHaloCells, int iRadius);
+void freeActivity(LifeActivity &activity);
+void beginActivity(LifeActivity &activity);
+void compareHalos(LifeActivity &activity, const LifeGrid &grid);
+int listActiveTiles(LifeActivity &activity, LifeTiles tiles);
+void nextGenerationTiles(LifeActivity &activity, const LifeGrid &grid, LifeGrid &gridNew, int iLevel, int iThread, LifeStats *stats);
+void endActivity(LifeActivity &activity);
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * The dynamic load balancing of the 2D block decomposition.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the load balancing
+#include "life_balance.h"
+
+// New boundaries of iParts blocks of iCount rows (or columns): dWork[k] is the work of the block k.
+// Every boundary moves halfway to where all blocks get the same work, every block keeps iDepth rows.
+static void moveBoundaries(const int *iStarts, const double *dWork, int iParts, int iCount, int iDepth, int *iNewStarts)
+{
+	double dTotal = 0;
+	for(int k = 0; k < iParts; k++)
+		dTotal += dWork[k];
+
+	iNewStarts[0] = 1;
+	iNewStarts[iParts] = iCount + 1;
+
+	double dBefore = 0;
+	int a = 0;
+	for(int k = 1; k < iParts; k++)
+	{
+		// The block holding the even share of the first k blocks, its work spread evenly over its rows
+		double dTarget = dTotal * k / iParts;
+		while(a < iParts - 1 && dBefore + dWork[a] < dTarget)
+			dBefore += dWork[a++];
+
+		int iSize = iStarts[a + 1] - iStarts[a];
+		double dIdeal = iStarts[a] + ((dWork[a] > 0) ? (dTarget - dBefore) / dWork[a] * iSize : 0);
+		int iStart = (int) (iStarts[k] + (dIdeal - iStarts[k]) / 2 + 0.5);
+
+		// Room for the blocks before and after
+		if(iStart < iNewStarts[k - 1] + iDepth)
+			iStart = iNewStarts[k - 1] + iDepth;
+		if(iStart > iCount + 1 - (iParts - k) * iDepth)
+			iStart = iCount + 1 - (iParts - k) * iDepth;
+		iNewStarts[k] = iStart;
+	}
+}
+
+// Share the compute times of the processes and find the new boundaries of the blocks.
+// Returns 0 (on all processes) when the blocks are balanced well enough or would not move.
+// Collective: every process of the domain calls it.
+int balanceBoundaries(const LifeDomain &domain, double dComputeTime, int iGlobalRowCount, int iGlobalColumnCount,
+					  int *iRowStarts, int *iColumnStarts)
+{
+	int iProcesses;
+	MPI_Comm_size(domain.cartComm, &iProcesses);
+
+	double *dTimes = (double *) malloc(iProcesses * sizeof(double));
+	MPI_Allgather(&dComputeTime, 1, MPI_DOUBLE, dTimes, 1, MPI_DOUBLE, domain.cartComm);
+
+	// Work of the rows of blocks and of the columns of blocks
+	double *dRowWork = (double *) calloc(domain.iDims[0], sizeof(double));
+	double *dColumnWork = (double *) calloc(domain.iDims[1], sizeof(double));
+	double dTotal = 0, dSlowest = 0;
+	for(int p = 0; p < iProcesses; p++)
+	{
+		int iCoords[2];
+		MPI_Cart_coords(domain.cartComm, p, 2, iCoords);
+		dRowWork[iCoords[0]] += dTimes[p];
+		dColumnWork[iCoords[1]] += dTimes[p];
+		dTotal += dTimes[p];
+		if(dTimes[p] > dSlowest)
+			dSlowest = dTimes[p];
+	}
+
+	int iMoved = 0;
+	if(dTotal > 0 && dSlowest > (1 + LIFE_BALANCE_TOLERANCE) * dTotal / iProcesses)
+	{
+		moveBoundaries(domain.iRowStarts, dRowWork, domain.iDims[0], iGlobalRowCount, domain.iDepth, iRowStarts);
+		moveBoundaries(domain.iColumnStarts, dColumnWork, domain.iDims[1], iGlobalColumnCount, domain.iDepth, iColumnStarts);
+
+		iMoved = memcmp(iRowStarts, domain.iRowStarts, (domain.iDims[0] + 1) * sizeof(int)) != 0 ||
+				 memcmp(iColumnStarts, domain.iColumnStarts, (domain.iDims[1] + 1) * sizeof(int)) != 0;
+	}
+
+	free(dTimes);
+	free(dRowWork);
+	free(dColumnWork);
+	return iMoved;
+}
+
+// Rows [iRowStart, iRowEnd) and columns [iColumnStart, iColumnEnd) shared by the block (iRow, iColumn) of the boundaries
+// iRowStarts / iColumnStarts and the block (iOtherRow, iOtherColumn) of the boundaries iOtherRowStarts / iOtherColumnStarts
+static void intersectBlocks(const int *iRowStarts, const int *iColumnStarts, const int iCoords[2],
+							const int *iOtherRowStarts, const int *iOtherColumnStarts, const int iOtherCoords[2],
+							int &iRowStart, int &iRowEnd, int &iColumnStart, int &iColumnEnd)
+{
+	iRowStart = iRowStarts[iCoords[0]];
+	if(iOtherRowStarts[iOtherCoords[0]] > iRowStart)
+		iRowStart = iOtherRowStarts[iOtherCoords[0]];
+	iRowEnd = iRowStarts[iCoords[0] + 1];
+	if(iOtherRowStarts[iOtherCoords[0] + 1] < iRowEnd)
+		iRowEnd = iOtherRowStarts[iOtherCoords[0] + 1];
+
+	iColumnStart = iColumnStarts[iCoords[1]];
+	if(iOtherColumnStarts[iOtherCoords[1]] > iColumnStart)
+		iColumnStart = iOtherColumnStarts[iOtherCoords[1]];
+	iColumnEnd = iColumnStarts[iCoords[1] + 1];
+	if(iOtherColumnStarts[iOtherCoords[1] + 1] < iColumnEnd)
+		iColumnEnd = iOtherColumnStarts[iOtherCoords[1] + 1];
+
+	if(iRowEnd < iRowStart)
+		iRowEnd = iRowStart;
+	if(iColumnEnd < iColumnStart)
+		iColumnEnd = iColumnStart;
+}
+
+// Move the cells to the blocks of the new boundaries: gridBlock, allocated for the new block with its halos and cleared
+// by the team (placeGridTeam), takes the cells and becomes the grid, the old grid is freed (the halos are empty).
+// Collective: every process of the domain calls it.
+void migrateBlocks(LifeDomain &domain, LifeGrid &grid, LifeGrid &gridBlock, const int *iRowStarts, const int *iColumnStarts)
+{
+	int iProcesses;
+	MPI_Comm_size(domain.cartComm, &iProcesses);
+
+	int *iSendCounts = (int *) malloc(4 * iProcesses * sizeof(int));
+	int *iSendDispls = iSendCounts + iProcesses, *iRecvCounts = iSendCounts + 2 * iProcesses, *iRecvDispls = iSendCounts + 3 * iProcesses;
+
+	// Cells of the own block going to the new block of every process, and cells of the old block of every process coming in.
+	// Every row of cells starts on a word of its own.
+	int iSendWords = 0, iRecvWords = 0;
+	for(int p = 0; p < iProcesses; p++)
+	{
+		int iCoords[2], iRowStart, iRowEnd, iColumnStart, iColumnEnd;
+		MPI_Cart_coords(domain.cartComm, p, 2, iCoords);
+
+		intersectBlocks(domain.iRowStarts, domain.iColumnStarts, domain.iCoords, iRowStarts, iColumnStarts, iCoords,
+						iRowStart, iRowEnd, iColumnStart, iColumnEnd);
+		iSendDispls[p] = iSendWords;
+		iSendCounts[p] = (iRowEnd - iRowStart) * ((iColumnEnd - iColumnStart + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS);
+		iSendWords += iSendCounts[p];
+
+		intersectBlocks(domain.iRowStarts, domain.iColumnStarts, iCoords, iRowStarts, iColumnStarts, domain.iCoords,
+						iRowStart, iRowEnd, iColumnStart, iColumnEnd);
+		iRecvDispls[p] = iRecvWords;
+		iRecvCounts[p] = (iRowEnd - iRowStart) * ((iColumnEnd - iColumnStart + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS);
+		iRecvWords += iRecvCounts[p];
+	}
+
+	LifeWord *uSend = (LifeWord *) calloc(iSendWords + 1, sizeof(LifeWord));
+	LifeWord *uRecv = (LifeWord *) calloc(iRecvWords + 1, sizeof(LifeWord));
+	int d = domain.iDepth;
+
+	for(int p = 0; p < iProcesses; p++)
+	{
+		if(!iSendCounts[p])
+			continue;
+
+		int iCoords[2], iRowStart, iRowEnd, iColumnStart, iColumnEnd;
+		MPI_Cart_coords(domain.cartComm, p, 2, iCoords);
+		intersectBlocks(domain.iRowStarts, domain.iColumnStarts, domain.iCoords, iRowStarts, iColumnStarts, iCoords,
+						iRowStart, iRowEnd, iColumnStart, iColumnEnd);
+
+		LifeWord *uRow = uSend + iSendDispls[p];
+		int iWords = (iColumnEnd - iColumnStart + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS;
+		for(int i = iRowStart; i < iRowEnd; i++, uRow += iWords)
+			copyBits(uRow, 0, getRow(grid, d + i - domain.iRowStart), d + iColumnStart - domain.iColumnStart, iColumnEnd - iColumnStart);
+	}
+
+	MPI_Alltoallv(uSend, iSendCounts, iSendDispls, MPI_UINT64_T, uRecv, iRecvCounts, iRecvDispls, MPI_UINT64_T, domain.cartComm);
+
+	// The new block with its halos
+	int iNewRowStart = iRowStarts[domain.iCoords[0]], iNewColumnStart = iColumnStarts[domain.iCoords[1]];
+
+	for(int p = 0; p < iProcesses; p++)
+	{
+		if(!iRecvCounts[p])
+			continue;
+
+		int iCoords[2], iRowStart, iRowEnd, iColumnStart, iColumnEnd;
+		MPI_Cart_coords(domain.cartComm, p, 2, iCoords);
+		intersectBlocks(domain.iRowStarts, domain.iColumnStarts, iCoords, iRowStarts, iColumnStarts, domain.iCoords,
+						iRowStart, iRowEnd, iColumnStart, iColumnEnd);
+
+		const LifeWord *uRow = uRecv + iRecvDispls[p];
+		int iWords = (iColumnEnd - iColumnStart + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS;
+		for(int i = iRowStart; i < iRowEnd; i++, uRow += iWords)
+			copyBits(getRow(gridBlock, d + i - iNewRowStart), d + iColumnStart - iNewColumnStart, uRow, 0, iColumnEnd - iColumnStart);
+	}
+
+	free(uSend);
+	free(uRecv);
+	free(iSendCounts);
+
+	freeGrid(grid);
+	grid = gridBlock;
+
+	memcpy(domain.iRowStarts, iRowStarts, (domain.iDims[0] + 1) * sizeof(int));
+	memcpy(domain.iColumnStarts, iColumnStarts, (domain.iDims[1] + 1) * sizeof(int));
+	setBlocks(domain);
+}
@@ -0,0 +1,38 @@
+/*
+ * The dynamic load balancing of the 2D block decomposition.
+ *
+ * Every process measures the time it spends computing its block. From time to
+ * time the processes share these times and move the boundaries of the rows of
+ * blocks and of the columns of blocks: the work of a block is taken as spread
+ * evenly over its rows and columns, and every row (column) of blocks is given
+ * an even share of the work of all of them. The boundaries move halfway to the
+ * even share at once, and only when the slowest process takes more than
+ * LIFE_BALANCE_TOLERANCE longer than the average one.
+ *
+ * The cells then move to their new owners, mostly the neighbouring processes,
+ * in one MPI_Alltoallv. They go into a grid of the new block which the caller
+ * allocates untouched and its team of threads clears first (placeGridTeam of
+ * the hybrid program, within the parallel region), so its pages stay on the
+ * NUMA nodes of the threads computing them.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+#if !defined LIFE_BALANCE_H
+#define LIFE_BALANCE_H
+
+// Including the bit-packed grid and the decomposition
+#include "life_grid.h"
+#include "life_domain.h"
+
+// Imbalance (slowest process over the average one) accepted without moving the blocks
+#define LIFE_BALANCE_TOLERANCE 0.1
+
+// Signature of the methods
+int balanceBoundaries(const LifeDomain &domain, double dComputeTime, int iGlobalRowCount, int iGlobalColumnCount,
+					  int *iRowStarts, int *iColumnStarts);
+void migrateBlocks(LifeDomain &domain, LifeGrid &grid, LifeGrid &gridBlock, const int *iRowStarts, const int *iColumnStarts);
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ * The boundaries of the grid: a torus, dead edges or a grid growing with its pattern.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cstring>
+
+// Including the boundaries of the grid
+#include "life_bounds.h"
+
+// Names of the boundaries, in the order of LifeBoundary
+static const char *cBoundaryNames[] = { "torus", "dead", "grow" };
+
+// Read the boundary given as torus, dead or grow. Returns 0 if it is none of these.
+int parseBoundary(LifeBoundary &boundary, const char *sBoundary)
+{
+	for(int b = LIFE_BOUNDARY_TORUS; b <= LIFE_BOUNDARY_GROW; b++)
+		if(strcmp(sBoundary, cBoundaryNames[b]) == 0)
+		{
+			boundary = (LifeBoundary) b;
+			return 1;
+		}
+	return 0;
+}
+
+// Name of the boundary
+const char *getBoundaryName(LifeBoundary boundary)
+{
+	return cBoundaryNames[boundary];
+}
+
+// Kill the cells of the outer layers of iDepth rows and columns, whatever a generation left there
+void clearOuterLayers(LifeGrid &grid, int iDepth)
+{
+	for(int i = 0; i < iDepth; i++)
+	{
+		memset(getRow(grid, i), 0, grid.iWordCount * sizeof(LifeWord));
+		memset(getRow(grid, grid.iRowCount - 1 - i), 0, grid.iWordCount * sizeof(LifeWord));
+	}
+
+	for(int i = iDepth; i < grid.iRowCount - iDepth; i++)
+	{
+		clearBits(getRow(grid, i), 0, iDepth);
+		clearBits(getRow(grid, i), grid.iColumnCount - iDepth, iDepth);
+	}
+}
+
+// Bounding box of the live cells within the outer layers of iDepth rows and columns: the rows [iBounds[0], iBounds[1])
+// and the columns [iBounds[2], iBounds[3]). Returns 0 when no cell is alive.
+int findLiveBounds(const LifeGrid &grid, int iDepth, int iBounds[4])
+{
+	int iFirstWord = grid.iWordCount, iLastWord = -1;
+	LifeWord uFirstBits = 0, uLastBits = 0;
+	iBounds[0] = -1;
+
+	for(int i = iDepth; i < grid.iRowCount - iDepth; i++)
+	{
+		const LifeWord *uRow = getRow(grid, i);
+		for(int w = 0; w < grid.iWordCount; w++)
+		{
+			if(!uRow[w])
+				continue;
+
+			if(iBounds[0] < 0)
+				iBounds[0] = i;
+			iBounds[1] = i + 1;
+
+			// The leftmost and rightmost words holding a live cell, with the live cells of them in any row
+			if(w < iFirstWord)
+			{
+				iFirstWord = w;
+				uFirstBits = 0;
+			}
+			if(w == iFirstWord)
+				uFirstBits |= uRow[w];
+			if(w > iLastWord)
+			{
+				iLastWord = w;
+				uLastBits = 0;
+			}
+			if(w == iLastWord)
+				uLastBits |= uRow[w];
+		}
+	}
+
+	if(iBounds[0] < 0)
+		return 0;
+
+	iBounds[2] = iFirstWord * LIFE_WORD_BITS + __builtin_ctzll(uFirstBits);
+	iBounds[3] = iLastWord * LIFE_WORD_BITS + LIFE_WORD_BITS - __builtin_clzll(uLastBits);
+	return 1;
+}
+
+// Largest multiple of iTile not above lValue
+static long long floorTile(long long lValue, int iTile)
+{
+	long long lTiles = lValue / iTile;
+	if(lValue % iTile < 0)
+		lTiles--;
+	return lTiles * iTile;
+}
+
+// The window of a grid with outer layers of iDepth rows and columns, holding the first cells of the plane.
+// The live cells spread iRadius cells per generation at most: a tile keeps them inside for the generations between two looks.
+void createWindow(LifeWindow &window, const LifeGrid &grid, int iDepth, int iRadius)
+{
+	int iTile = (LIFE_GROW_TILE_ROWS < LIFE_GROW_TILE_COLUMNS) ? LIFE_GROW_TILE_ROWS : LIFE_GROW_TILE_COLUMNS;
+
+	window.lRowOrigin = window.lColumnOrigin = 0;
+	window.iDepth = iDepth;
+	window.iCheckEvery = (iTile / (2 * iRadius) > 1) ? iTile / (2 * iRadius) : 1;
+	window.iMargin = window.iCheckEvery * iRadius;
+	window.iResizeCount = 0;
+	window.lLargestCells = (long) (grid.iRowCount - 2 * iDepth) * (grid.iColumnCount - 2 * iDepth);
+}
+
+// Look at the live cells: when they come closer to an edge than the margin, or when the window is more than twice the
+// tiles they need, the window moves onto the tiles around the live cells and their margin. Returns 1 if it moved.
+int fitWindow(LifeWindow &window, LifeGrid &grid, LifeGrid &gridNew)
+{
+	int d = window.iDepth, m = window.iMargin;
+	int iRowCount = grid.iRowCount - 2 * d, iColumnCount = grid.iColumnCount - 2 * d;
+
+	// Tiles of the plane around the live cells (a single tile at the window if all cells are dead)
+	int iBounds[4];
+	int iAlive = findLiveBounds(grid, d, iBounds);
+	long long lTop, lBottom, lLeft, lRight;
+	int iFits = 1;
+	if(iAlive)
+	{
+		lTop = floorTile(window.lRowOrigin + iBounds[0] - d - m, LIFE_GROW_TILE_ROWS);
+		lBottom = floorTile(window.lRowOrigin + iBounds[1] - d + m - 1, LIFE_GROW_TILE_ROWS) + LIFE_GROW_TILE_ROWS;
+		lLeft = floorTile(window.lColumnOrigin + iBounds[2] - d - m, LIFE_GROW_TILE_COLUMNS);
+		lRight = floorTile(window.lColumnOrigin + iBounds[3] - d + m - 1, LIFE_GROW_TILE_COLUMNS) + LIFE_GROW_TILE_COLUMNS;
+		iFits = iBounds[0] - d >= m && iRowCount + d - iBounds[1] >= m && iBounds[2] - d >= m && iColumnCount + d - iBounds[3] >= m;
+	}
+	else
+	{
+		lTop = floorTile(window.lRowOrigin, LIFE_GROW_TILE_ROWS);
+		lBottom = lTop + LIFE_GROW_TILE_ROWS;
+		lLeft = floorTile(window.lColumnOrigin, LIFE_GROW_TILE_COLUMNS);
+		lRight = lLeft + LIFE_GROW_TILE_COLUMNS;
+	}
+
+	if(iFits && 2 * (lBottom - lTop) * (lRight - lLeft) > (long long) iRowCount * iColumnCount)
+		return 0;
+
+	// The live cells move into grids of the new window, the rest of it is dead
+	LifeGrid gridMoved;
+	allocateGrid(gridMoved, (int) (lBottom - lTop) + 2 * d, (int) (lRight - lLeft) + 2 * d);
+	if(iAlive)
+		copyBlock(gridMoved, (int) (window.lRowOrigin + iBounds[0] - lTop), (int) (window.lColumnOrigin + iBounds[2] - lLeft),
+				  grid, iBounds[0], iBounds[2], iBounds[1] - iBounds[0], iBounds[3] - iBounds[2]);
+
+	freeGrid(grid);
+	freeGrid(gridNew);
+	grid = gridMoved;
+	allocateGrid(gridNew, grid.iRowCount, grid.iColumnCount);
+
+	window.lRowOrigin = lTop;
+	window.lColumnOrigin = lLeft;
+	window.iResizeCount++;
+	if((long) (lBottom - lTop) * (lRight - lLeft) > window.lLargestCells)
+		window.lLargestCells = (long) (lBottom - lTop) * (lRight - lLeft);
+	return 1;
+}
@@ -0,0 +1,55 @@
+/*
+ * The boundaries of the grid: a torus, dead edges or a grid growing with its pattern.
+ *
+ * On a torus the outer layers are copies of the opposite edges. With dead
+ * edges the grid is a bounded box, the cells beyond its edges are dead for
+ * good. A growing grid is a window onto the unbounded plane: every iCheckEvery
+ * generations the bounding box of the live cells is looked up, and the window
+ * is moved, grown or shrunk in tiles of LIFE_GROW_TILE_ROWS rows by
+ * LIFE_GROW_TILE_COLUMNS columns to hold the box with a margin of dead cells.
+ * The margin is wider than the live cells can spread until the next look
+ * (iRadius cells per generation), so the dead outer layers are the plane
+ * around the window, and memory and work follow the pattern.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#if !defined LIFE_BOUNDS_H
+#define LIFE_BOUNDS_H
+
+// Including the bit-packed grid
+#include "life_grid.h"
+
+// Rows and columns of the tiles of a growing grid
+#define LIFE_GROW_TILE_ROWS 64
+#define LIFE_GROW_TILE_COLUMNS 64
+
+// Boundaries of the grid
+enum LifeBoundary
+{
+	LIFE_BOUNDARY_TORUS, LIFE_BOUNDARY_DEAD, LIFE_BOUNDARY_GROW
+};
+
+// Window of a growing grid onto the plane
+struct LifeWindow
+{
+	long long lRowOrigin;		// Row of the plane of the first cell of the grid (the first row of the input being 0)
+	long long lColumnOrigin;	// Column of the plane of the first cell of the grid
+	int iDepth;					// Rows and columns of the outer layers
+	int iMargin;				// Dead cells kept around the live cells
+	int iCheckEvery;			// Generations between two looks at the live cells
+	int iResizeCount;			// Times the window moved, grew or shrank
+	long lLargestCells;			// Cells of the largest window so far
+};
+
+// Signature of the methods
+int parseBoundary(LifeBoundary &boundary, const char *sBoundary);
+const char *getBoundaryName(LifeBoundary boundary);
+void clearOuterLayers(LifeGrid &grid, int iDepth);
+int findLiveBounds(const LifeGrid &grid, int iDepth, int iBounds[4]);
+void createWindow(LifeWindow &window, const LifeGrid &grid, int iDepth, int iRadius);
+int fitWindow(LifeWindow &window, LifeGrid &grid, LifeGrid &gridNew);
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * Checkpoints of a long Game of Life run.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+
+// Including the checkpoints and the parallel output
+#include "life_checkpoint.h"
+#include "life_io.h"
+
+using namespace std;
+
+// Set up the checkpoints of a run starting at the generation uGeneration and the buffers of the snapshots of the block of the
+// process, nothing is written yet
+void createCheckpoint(LifeCheckpoint &checkpoint, const LifeDomain &domain, int iGlobalColumnCount, const char *sFileName,
+					  int iEvery, double dSeconds, uint64_t uGeneration)
+{
+	checkpoint.sFileName = sFileName;
+	checkpoint.sTempFileName = checkpoint.sFileName + ".tmp";
+	checkpoint.iEvery = iEvery;
+	checkpoint.uLastGeneration = uGeneration;
+	checkpoint.dSeconds = dSeconds;
+	checkpoint.dLastTime = MPI_Wtime();
+
+	for(int b = 0; b < 2; b++)
+	{
+		checkpoint.iBufferSizes[b] = blockFileBytes(domain, iGlobalColumnCount);
+		checkpoint.cBuffers[b] = (unsigned char *) malloc(checkpoint.iBufferSizes[b]);
+	}
+	checkpoint.iBuffer = 0;
+	checkpoint.iPending = 0;
+	checkpoint.iWriteDone = 0;
+	checkpoint.iDonePending = 0;
+	checkpoint.iTimerFlag = 0;
+	checkpoint.iTimerPending = 0;
+}
+
+// Close the file of the finished write and put it in place of the checkpoint.
+// Collective: every process of the domain calls it once the write is complete on all of them.
+static void replaceCheckpoint(LifeCheckpoint &checkpoint, const LifeDomain &domain)
+{
+	MPI_File_close(&checkpoint.file);
+	checkpoint.iPending = 0;
+
+	int iRank;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+	if(iRank == 0 && rename(checkpoint.sTempFileName.c_str(), checkpoint.sFileName.c_str()) != 0)
+		cerr << "Unable to replace the checkpoint " << checkpoint.sFileName << endl;
+}
+
+// Take in the reduction of the last generation: the checkpoint is replaced once the write is complete on all processes
+static void takeDone(LifeCheckpoint &checkpoint, const LifeDomain &domain)
+{
+	if(!checkpoint.iDonePending)
+		return;
+
+	MPI_Wait(&checkpoint.doneRequest, MPI_STATUS_IGNORE);
+	checkpoint.iDonePending = 0;
+	if(checkpoint.iAllDone)
+		replaceCheckpoint(checkpoint, domain);
+}
+
+// Complete the write in flight and put the temporary file in place of the checkpoint
+static void completeWrite(LifeCheckpoint &checkpoint, const LifeDomain &domain)
+{
+	takeDone(checkpoint, domain);
+	if(!checkpoint.iPending)
+		return;
+
+	MPI_Wait(&checkpoint.writeRequest, MPI_STATUS_IGNORE);
+	replaceCheckpoint(checkpoint, domain);
+}
+
+// Take a snapshot of the generation uGeneration when it is due.
+// Collective: every process of the domain calls it after every generation.
+void checkpointGeneration(LifeCheckpoint &checkpoint, const LifeDomain &domain, const LifeGrid &grid,
+						  int iGlobalRowCount, int iGlobalColumnCount, uint64_t uGeneration)
+{
+	int iRank;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+
+	// Generations may advance several at a time (deep halos), a snapshot is due once iEvery of them have passed
+	int iDue = (checkpoint.iEvery > 0 && uGeneration - checkpoint.uLastGeneration >= (uint64_t) checkpoint.iEvery);
+
+	// The decision of process 0 from the last generation
+	if(checkpoint.iTimerPending)
+	{
+		MPI_Wait(&checkpoint.timerRequest, MPI_STATUS_IGNORE);
+		checkpoint.iTimerPending = 0;
+		iDue = iDue || checkpoint.iTimerFlag;
+	}
+
+	// The write completed everywhere by the last generation replaces the checkpoint at once
+	takeDone(checkpoint, domain);
+
+	if(iDue)
+	{
+		// The grid is packed at once, it changes with the next generation. The buffer is not the one in flight,
+		// it only grows when the load balancing gave the block more rows.
+		int b = checkpoint.iBuffer;
+		size_t iBufferSize = blockFileBytes(domain, iGlobalColumnCount);
+		if(iBufferSize > checkpoint.iBufferSizes[b])
+		{
+			free(checkpoint.cBuffers[b]);
+			checkpoint.cBuffers[b] = (unsigned char *) malloc(iBufferSize);
+			checkpoint.iBufferSizes[b] = iBufferSize;
+		}
+		MPI_Datatype slabType;
+		MPI_Offset iOffset = packBlockFile(domain, grid, iGlobalRowCount, iGlobalColumnCount, uGeneration, checkpoint.cBuffers[b], slabType);
+
+		// Only one write is in flight at a time
+		completeWrite(checkpoint, domain);
+
+		checkpoint.uLastGeneration = uGeneration;
+		checkpoint.iBuffer = 1 - b;
+
+		MPI_File_open(domain.cartComm, checkpoint.sTempFileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &checkpoint.file);
+		MPI_File_set_size(checkpoint.file, 0);
+		MPI_File_set_view(checkpoint.file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+		MPI_File_iwrite_at_all(checkpoint.file, iOffset, checkpoint.cBuffers[b], (iBufferSize > 0) ? 1 : 0, slabType, &checkpoint.writeRequest);
+		MPI_Type_free(&slabType);
+		checkpoint.iPending = 1;
+		checkpoint.iWriteDone = 0;
+
+		if(iRank == 0)
+		{
+			checkpoint.dLastTime = MPI_Wtime();
+			cout << "Checkpoint of generation " << uGeneration << " started" << endl;
+		}
+	}
+	else if(checkpoint.iPending)
+	{
+		// Let the write in flight make progress. The file is closed by all processes together, so whether the write
+		// is complete on all of them is reduced and taken in after the next generation.
+		if(!checkpoint.iWriteDone)
+			MPI_Test(&checkpoint.writeRequest, &checkpoint.iWriteDone, MPI_STATUS_IGNORE);
+		MPI_Iallreduce(&checkpoint.iWriteDone, &checkpoint.iAllDone, 1, MPI_INT, MPI_MIN, domain.cartComm, &checkpoint.doneRequest);
+		checkpoint.iDonePending = 1;
+	}
+
+// Process 0 tells whether the time of a snapshot has come, the others learn it after the next generation
+	if(checkpoint.dSeconds > 0)
+	{
+		if(iRank == 0)
+			checkpoint.iTimerFlag = (MPI_Wtime() - checkpoint.dLastTime >= checkpoint.dSeconds);
+		MPI_Ibcast(&checkpoint.iTimerFlag, 1, MPI_INT, 0, domain.cartComm, &checkpoint.timerRequest);
+		checkpoint.iTimerPending = 1;
+	}
+}
+
+// Complete the broadcast and the write in flight.
+// Collective: every process of the domain calls it once the run is over.
+void finishCheckpoint(LifeCheckpoint &checkpoint, const LifeDomain &domain)
+{
+	if(checkpoint.iTimerPending)
+	{
+		MPI_Wait(&checkpoint.timerRequest, MPI_STATUS_IGNORE);
+		checkpoint.iTimerPending = 0;
+	}
+
+	completeWrite(checkpoint, domain);
+}
+
+// Release the buffers
+void freeCheckpoint(LifeCheckpoint &checkpoint)
+{
+	free(checkpoint.cBuffers[0]);
+	free(checkpoint.cBuffers[1]);
+	checkpoint.cBuffers[0] = checkpoint.cBuffers[1] = NULL;
+}
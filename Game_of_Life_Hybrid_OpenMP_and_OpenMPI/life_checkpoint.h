@@ -0,0 +1,75 @@
+/*
+ * Checkpoints of a long Game of Life run.
+ *
+ * Every iEvery generations and/or every dSeconds seconds the grid is saved as a
+ * binary grid file (life_file.h), written by all processes at once. The file
+ * does not depend on the decomposition, so a run can restart from it with
+ * another number of processes.
+ *
+ * Taking a snapshot only packs the block into a buffer; the buffer is written
+ * with a non-blocking collective write (MPI_File_iwrite_at_all) while the next
+ * generations are computed. The two buffers are allocated with the checkpoints
+ * (a block grown by the load balancing enlarges them), the next snapshot is
+ * packed into the other one before the previous write has to be complete. The
+ * write goes to a temporary file which replaces the checkpoint as soon as the
+ * write is complete on all processes, so the checkpoint on disk is always a
+ * whole one.
+ *
+ * Process 0 keeps the clock: its decision to take a snapshot reaches the other
+ * processes through a non-blocking broadcast, one generation later. Whether the
+ * write is complete everywhere is learnt the same way, through a non-blocking
+ * reduction.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+#if !defined LIFE_CHECKPOINT_H
+#define LIFE_CHECKPOINT_H
+
+// Including libraries
+#include <mpi.h>
+#include <string>
+#include <stdint.h>
+
+// Including the bit-packed grid and its decomposition
+#include "life_grid.h"
+#include "life_domain.h"
+
+// State of the checkpoints of a run
+struct LifeCheckpoint
+{
+	std::string sFileName;			// The checkpoint
+	std::string sTempFileName;		// The checkpoint being written
+	int iEvery;						// Generations between two snapshots (0: never)
+	uint64_t uLastGeneration;		// Generation of the last snapshot (or of the start)
+	double dSeconds;				// Seconds between two snapshots (0: never)
+	double dLastTime;				// Time of the last snapshot (process 0)
+
+	unsigned char *cBuffers[2];		// Packed snapshots: the one being written and the next one
+	size_t iBufferSizes[2];			// Bytes of the buffers
+	int iBuffer;					// Buffer of the next snapshot
+	int iPending;					// Whether a write is in flight
+	MPI_File file;					// File of the write in flight
+	MPI_Request writeRequest;		// The write in flight
+
+	int iWriteDone;					// Whether the write in flight is complete on the process
+	int iAllDone;					// Whether it is complete on all processes (reduced)
+	int iDonePending;				// Whether the reduction is in flight
+	MPI_Request doneRequest;		// The reduction in flight
+
+	int iTimerFlag;					// Whether the time of a snapshot has come (broadcast by process 0)
+	int iTimerPending;				// Whether the broadcast is in flight
+	MPI_Request timerRequest;		// The broadcast in flight
+};
+
+// Signature of the methods
+void createCheckpoint(LifeCheckpoint &checkpoint, const LifeDomain &domain, int iGlobalColumnCount, const char *sFileName,
+					  int iEvery, double dSeconds, uint64_t uGeneration);
+void checkpointGeneration(LifeCheckpoint &checkpoint, const LifeDomain &domain, const LifeGrid &grid,
+						  int iGlobalRowCount, int iGlobalColumnCount, uint64_t uGeneration);
+void finishCheckpoint(LifeCheckpoint &checkpoint, const LifeDomain &domain);
+void freeCheckpoint(LifeCheckpoint &checkpoint);
+
+#endif
@@ -0,0 +1,246 @@
+/*
+ *
+ * The Game of Life
+ *		- converter between the text grid, the binary grid file and the RLE pattern
+ *
+ * A text grid (the first line holds the number of rows and columns, the cells
+ * follow as 0 and 1 separated by blanks) becomes a binary grid file, and a
+ * binary grid file becomes a text grid of the fixed-width format.
+ *
+ * A frame of a snapshot stream (the last one, or the one of the generation given
+ * with --generation) becomes a text grid, or a binary grid file if the name of the
+ * output ends in ".bin".
+ *
+ * An RLE pattern becomes a text grid, or a binary grid file if the name of the output
+ * ends in ".bin". Any grid becomes an RLE pattern if the name of the output ends in ".rle".
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/17/2026
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <stdlib.h>
+#include <string.h>
+
+// Including the bit-packed grid, the binary grid file, the snapshot stream and the RLE pattern file
+#include "life_grid.h"
+#include "life_file.h"
+#include "life_stream.h"
+#include "life_rle.h"
+
+using namespace std;
+
+// Write the grid (with outer layers of one row and column) as a text grid of the fixed-width format
+void writeTextGrid(const char *sFileName, const LifeGrid &grid, int iRowCount, int iColumnCount)
+{
+	// Every row on a line of its own
+	ofstream fOutput(sFileName);
+	fOutput << iRowCount << " " << iColumnCount << "\n";
+
+	string sLine(2 * iColumnCount + 1, ' ');
+	sLine[2 * iColumnCount] = '\n';
+	for(int i = 1; i <= iRowCount; i++)
+	{
+		for(int j = 1; j <= iColumnCount; j++)
+			sLine[2 * (j - 1)] = (char) ('0' + getCell(grid, i, j));
+		fOutput << sLine;
+	}
+}
+
+// Unpack a frame of the stream: the last one, or the one of the generation sGeneration (unless it is NULL).
+// Returns 0 (with a message) when there is no such frame.
+int convertStream(const char *sStreamFile, const char *sGeneration, const char *sFileName)
+{
+	LifeStreamReader reader;
+	if(!openStreamReader(reader, sStreamFile))
+		return 0;
+
+	uint64_t uGeneration = sGeneration ? strtoull(sGeneration, NULL, 10) : 0;
+	int iFound = 0, iFrames = 0;
+	LifeFile fileFrame;
+	LifeGrid grid;
+	grid.uCells = NULL;
+	while(readFrame(reader))
+	{
+		iFrames++;
+		if(sGeneration && reader.frame.uGeneration != uGeneration)
+			continue;
+
+		// The rows of the frame are those of a binary grid file
+		int iRowCount = (int) reader.frame.uRowCount, iColumnCount = (int) reader.frame.uColumnCount;
+		fileFrame.header.uColumnCount = reader.frame.uColumnCount;
+		fileFrame.cRows = reader.cRows;
+		if(grid.uCells)
+			freeGrid(grid);
+		allocateGrid(grid, iRowCount + 2, iColumnCount + 2);
+		readRows(fileFrame, grid, 1, 1, 0, iRowCount, 0, iColumnCount);
+		uGeneration = reader.frame.uGeneration;
+		iFound = 1;
+
+		if(sGeneration)
+			break;
+	}
+
+	if(!iFound)
+	{
+		printf("The stream holds no frame of that generation (%d frames read).\n", iFrames);
+		closeStreamReader(reader);
+		return 0;
+	}
+
+	int iRowCount = grid.iRowCount - 2, iColumnCount = grid.iColumnCount - 2;
+	size_t iNameLength = strlen(sFileName);
+	if(iNameLength >= 4 && strcmp(sFileName + iNameLength - 4, ".bin") == 0)
+		writeLifeFile(sFileName, grid, 1, uGeneration);
+	else if(isRleOutput(sFileName))
+	{
+		// The stream knows nothing of the rule: the pattern is one of the Game of Life
+		LifeRule rule;
+		createRule(rule);
+		writeRleFile(sFileName, grid, 1, rule, uGeneration, reader.frame.iRowOrigin, reader.frame.iColumnOrigin);
+	}
+	else
+		writeTextGrid(sFileName, grid, iRowCount, iColumnCount);
+
+	cout << "Generation " << uGeneration << " (rows from " << (long long) reader.frame.iRowOrigin << ", columns from "
+		 << (long long) reader.frame.iColumnOrigin << ") has been written." << endl;
+
+	freeGrid(grid);
+	closeStreamReader(reader);
+	return 1;
+}
+
+// Main function
+int main(int argc, char *argv[])
+{
+	// Checking the number of input has to be passed by the user
+	int iStream = argc >= 3 && isStreamFile(argv[1]);
+	if (!(argc == 3 || (iStream && argc == 5 && strcmp(argv[3], "--generation") == 0)))
+	{
+		printf("Usuage: ./<executable> <input_file> <output_file> [--generation <generation> (snapshot streams)]\n");
+		return -1;
+	}
+
+	if(iStream)
+		return convertStream(argv[1], (argc == 5) ? argv[4] : NULL, argv[2]) ? 0 : -1;
+
+	LifeGrid grid;
+	int iRowCount, iColumnCount;
+
+	// Any grid becomes an RLE pattern of the Game of Life, or of the rule of the pattern read
+	LifeRule rule;
+	createRule(rule);
+	int iRleOutput = isRleOutput(argv[2]);
+
+	if(isLifeFile(argv[1]))
+	{
+		// Binary grid file to text
+		LifeFile fileGrid;
+		if(!openLifeFile(fileGrid, argv[1]))
+			return -1;
+
+		iRowCount = (int) fileGrid.header.uRowCount;
+		iColumnCount = (int) fileGrid.header.uColumnCount;
+		if(checksumRows(fileGrid, 0, iRowCount) != fileGrid.header.uChecksum)
+		{
+			printf("The checksum of the input file does not match its grid.\n");
+			return -1;
+		}
+
+		allocateGrid(grid, iRowCount + 2, iColumnCount + 2);
+		readRows(fileGrid, grid, 1, 1, 0, iRowCount, 0, iColumnCount);
+		closeLifeFile(fileGrid);
+
+		if(iRleOutput)
+		{
+			if(!writeRleFile(argv[2], grid, 1, rule, fileGrid.header.uGeneration, 0, 0))
+			{
+				printf("Error writing the output file.\n");
+				return -1;
+			}
+			cout << "Generation " << fileGrid.header.uGeneration << " has been written as an RLE pattern." << endl;
+		}
+		else
+		{
+			writeTextGrid(argv[2], grid, iRowCount, iColumnCount);
+			cout << "Generation " << fileGrid.header.uGeneration << " has been written as text." << endl;
+		}
+	}
+	else if(isRleFile(argv[1]))
+	{
+		// RLE pattern to text, a binary grid file or an RLE pattern again
+		LifeRle rle;
+		if(!openRle(rle, argv[1]))
+			return -1;
+		if(rle.sRule[0] && !parseRule(rule, rle.sRule))
+			createRule(rule);
+
+		iRowCount = rle.iRowCount;
+		iColumnCount = rle.iColumnCount;
+		allocateGrid(grid, iRowCount + 2, iColumnCount + 2);
+		if(!readRleCells(rle, grid, 1, 1, 0, iRowCount, 0, iColumnCount))
+			return -1;
+		closeRle(rle);
+
+		size_t iNameLength = strlen(argv[2]);
+		int iWritten = 1;
+		if(iRleOutput)
+			iWritten = writeRleFile(argv[2], grid, 1, rule, rle.uGeneration, rle.lRowOrigin, rle.lColumnOrigin);
+		else if(iNameLength >= 4 && strcmp(argv[2] + iNameLength - 4, ".bin") == 0)
+			iWritten = writeLifeFile(argv[2], grid, 1, rle.uGeneration);
+		else
+			writeTextGrid(argv[2], grid, iRowCount, iColumnCount);
+
+		if(!iWritten)
+		{
+			printf("Error writing the output file.\n");
+			return -1;
+		}
+		cout << "Pattern of " << iRowCount << " * " << iColumnCount << " (rule " << (rle.sRule[0] ? rle.sRule : "B3/S23") << ") has been written." << endl;
+	}
+	else
+	{
+		// Text to binary grid file (or an RLE pattern)
+		ifstream fInput(argv[1]);
+		if (!fInput)
+		{
+			printf("Error opening the input file.\n");
+			return -1;
+		}
+
+		fInput >> iRowCount >> iColumnCount;
+		allocateGrid(grid, iRowCount + 2, iColumnCount + 2);
+
+		// Populating the grid from file
+		char cItem;
+		int iCounterRow = 1, iCounterColumn = 1;
+		while(fInput >> cItem)
+		{
+			if(iCounterColumn > iColumnCount)
+			{
+				iCounterRow++;
+				iCounterColumn = 1;
+			}
+
+			if(iCounterRow > iRowCount)
+				break;
+
+			setCell(grid, iCounterRow, iCounterColumn, cItem - '0');
+			iCounterColumn++;
+		}
+
+		if(!(iRleOutput ? writeRleFile(argv[2], grid, 1, rule, 0, 0, 0) : writeLifeFile(argv[2], grid, 1, 0)))
+		{
+			printf("Error writing the output file.\n");
+			return -1;
+		}
+
+		cout << "Grid of " << iRowCount << " * " << iColumnCount << " has been written as " << (iRleOutput ? "an RLE pattern." : "a binary grid file.") << endl;
+	}
+
+	freeGrid(grid);
+
+	return 0;
+}
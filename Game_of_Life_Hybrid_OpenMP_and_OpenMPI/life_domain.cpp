@@ -0,0 +1,152 @@
+/*
+ * The 2D block decomposition of the Game of Life grid over the processes.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.4 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+
+// Including the decomposition
+#include "life_domain.h"
+
+// Factorize the processes into iDims[0] * iDims[1] blocks with the smallest halo per process.
+// Returns 0 when no factorization leaves every block at least iDepth rows and columns (the depth of the halos).
+int chooseProcessGrid(int iProcesses, int iRowCount, int iColumnCount, int iDepth, int iDims[2])
+{
+	double dBestHalo = -1;
+
+	for(int iRows = 1; iRows <= iProcesses; iRows++)
+	{
+		if(iProcesses % iRows)
+			continue;
+
+		int iColumns = iProcesses / iRows;
+		if(iRowCount / iRows < iDepth || iColumnCount / iColumns < iDepth)
+			continue;
+
+		// Cells of the halo rows and halo columns of a block
+		double dHalo = 2.0 * iColumnCount / iColumns + 2.0 * iRowCount / iRows;
+		if(dBestHalo < 0 || dHalo < dBestHalo)
+		{
+			dBestHalo = dHalo;
+			iDims[0] = iRows;
+			iDims[1] = iColumns;
+		}
+	}
+
+	return dBestHalo >= 0;
+}
+
+// Split iCount rows (or columns) into iParts blocks, the first (iCount % iParts) blocks get one more
+void blockRange(int iCount, int iParts, int iIndex, int &iStart, int &iSize)
+{
+	int iChunkSize = iCount / iParts;
+	int iChunkRemainder = iCount % iParts;
+
+	iSize = iChunkSize + (iIndex < iChunkRemainder ? 1 : 0);
+	iStart = 1 + (iIndex * iChunkSize) + (iIndex < iChunkRemainder ? iIndex : iChunkRemainder);
+}
+
+// Block of any process of the domain
+void blockOf(const LifeDomain &domain, int iRank, int &iRowStart, int &iRowSize, int &iColumnStart, int &iColumnSize)
+{
+	int iCoords[2];
+	MPI_Cart_coords(domain.cartComm, iRank, 2, iCoords);
+
+	iRowStart = domain.iRowStarts[iCoords[0]];
+	iRowSize = domain.iRowStarts[iCoords[0] + 1] - iRowStart;
+	iColumnStart = domain.iColumnStarts[iCoords[1]];
+	iColumnSize = domain.iColumnStarts[iCoords[1] + 1] - iColumnStart;
+}
+
+// Own block of the process and the widths of the blocks on the left and right, from the boundaries of the blocks
+void setBlocks(LifeDomain &domain)
+{
+	int iRow = domain.iCoords[0], iColumn = domain.iCoords[1];
+	domain.iRowStart = domain.iRowStarts[iRow];
+	domain.iRowCount = domain.iRowStarts[iRow + 1] - domain.iRowStart;
+	domain.iColumnStart = domain.iColumnStarts[iColumn];
+	domain.iColumnCount = domain.iColumnStarts[iColumn + 1] - domain.iColumnStart;
+
+	// The blocks on the left send their last columns, these are found by their width
+	int iWest = (iColumn - 1 + domain.iDims[1]) % domain.iDims[1], iEast = (iColumn + 1) % domain.iDims[1];
+	domain.iWestColumnCount = domain.iColumnStarts[iWest + 1] - domain.iColumnStarts[iWest];
+	domain.iEastColumnCount = domain.iColumnStarts[iEast + 1] - domain.iColumnStarts[iEast];
+}
+
+// Rows of the tallest block
+int tallestBlock(const LifeDomain &domain)
+{
+	int iTallest = 0;
+	for(int k = 0; k < domain.iDims[0]; k++)
+		if(domain.iRowStarts[k + 1] - domain.iRowStarts[k] > iTallest)
+			iTallest = domain.iRowStarts[k + 1] - domain.iRowStarts[k];
+	return iTallest;
+}
+
+// Build the process grid (periodic for a torus) and find the own block and the neighbours.
+// Returns 0 when the grid is too small for the number of processes and the depth of the halos.
+int createDomain(LifeDomain &domain, MPI_Comm communicator, int iGlobalRowCount, int iGlobalColumnCount, int iDepth, int iPeriodic)
+{
+	int iProcesses, iPeriods[2] = { iPeriodic, iPeriodic };
+	MPI_Comm_size(communicator, &iProcesses);
+
+	if(iDepth < 1 || !chooseProcessGrid(iProcesses, iGlobalRowCount, iGlobalColumnCount, iDepth, domain.iDims))
+		return 0;
+	domain.iDepth = iDepth;
+	domain.iPeriodic = iPeriodic;
+
+	// Ranks are not reordered: process 0 stays process 0
+	MPI_Cart_create(communicator, 2, domain.iDims, iPeriods, 0, &domain.cartComm);
+
+	int iRank, iSize;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+	MPI_Cart_coords(domain.cartComm, iRank, 2, domain.iCoords);
+
+	// Balanced blocks to begin with
+	domain.iRowStarts = (int *) malloc((domain.iDims[0] + 1) * sizeof(int));
+	domain.iColumnStarts = (int *) malloc((domain.iDims[1] + 1) * sizeof(int));
+	for(int k = 0; k < domain.iDims[0]; k++)
+		blockRange(iGlobalRowCount, domain.iDims[0], k, domain.iRowStarts[k], iSize);
+	for(int k = 0; k < domain.iDims[1]; k++)
+		blockRange(iGlobalColumnCount, domain.iDims[1], k, domain.iColumnStarts[k], iSize);
+	domain.iRowStarts[domain.iDims[0]] = iGlobalRowCount + 1;
+	domain.iColumnStarts[domain.iDims[1]] = iGlobalColumnCount + 1;
+	setBlocks(domain);
+
+	// Offsets of the neighbours, in the order of LifeDirection (the periodic grid wraps them around, beyond the edge
+	// of any other grid there is no neighbour)
+	const int iOffsets[LIFE_DIRECTIONS][2] =
+	{
+		{ -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 },
+		{ -1, -1 }, { -1, 1 }, { 1, -1 }, { 1, 1 }
+	};
+
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+	{
+		int iCoords[2] =
+		{
+			(domain.iCoords[0] + iOffsets[d][0] + domain.iDims[0]) % domain.iDims[0],
+			(domain.iCoords[1] + iOffsets[d][1] + domain.iDims[1]) % domain.iDims[1]
+		};
+		int iInside = domain.iCoords[0] + iOffsets[d][0] >= 0 && domain.iCoords[0] + iOffsets[d][0] < domain.iDims[0] &&
+					  domain.iCoords[1] + iOffsets[d][1] >= 0 && domain.iCoords[1] + iOffsets[d][1] < domain.iDims[1];
+		if(iPeriodic || iInside)
+			MPI_Cart_rank(domain.cartComm, iCoords, &domain.iNeighbors[d]);
+		else
+			domain.iNeighbors[d] = MPI_PROC_NULL;
+	}
+
+	return 1;
+}
+
+// Release the Cartesian communicator and the boundaries of the blocks
+void freeDomain(LifeDomain &domain)
+{
+	MPI_Comm_free(&domain.cartComm);
+	free(domain.iRowStarts);
+	free(domain.iColumnStarts);
+}
@@ -0,0 +1,65 @@
+/*
+ * The 2D block decomposition of the Game of Life grid over the processes.
+ *
+ * The processes form a periodic Cartesian grid (MPI_Cart_create) of
+ * iDims[0] rows by iDims[1] columns, every process owns one block of cells.
+ * The factorization of the processes is picked to exchange as few halo cells
+ * as possible.
+ *
+ * The blocks of a row of processes share their rows, the blocks of a column of
+ * processes their columns: iRowStarts and iColumnStarts hold the boundaries.
+ * They start out balanced and may be moved later on (see life_balance.h).
+ *
+ * The grid of a process holds its block with halos of iDepth rows and columns
+ * on each side: the cells of the block are the rows and columns iDepth ..
+ * (iDepth + iRowCount - 1) and iDepth .. (iDepth + iColumnCount - 1).
+ *
+ * The grid of blocks wraps around for a torus. Otherwise the blocks along the
+ * edges of the grid have no neighbour (MPI_PROC_NULL) on the side of the edge.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.4 10/18/2026
+ *
+ */
+
+#if !defined LIFE_DOMAIN_H
+#define LIFE_DOMAIN_H
+
+// Including libraries
+#include <mpi.h>
+
+// Directions of the neighbouring blocks
+enum LifeDirection
+{
+	LIFE_NORTH, LIFE_SOUTH, LIFE_WEST, LIFE_EAST,
+	LIFE_NORTH_WEST, LIFE_NORTH_EAST, LIFE_SOUTH_WEST, LIFE_SOUTH_EAST,
+	LIFE_DIRECTIONS
+};
+
+// Block of the grid owned by a process
+struct LifeDomain
+{
+	MPI_Comm cartComm;					// Periodic Cartesian communicator (ranks as in MPI_COMM_WORLD)
+	int iDims[2];						// Processes along the rows and along the columns
+	int iCoords[2];						// Position of the process
+	int iRowStart, iRowCount;			// First row (counting from 1 as in the layered grid) and number of rows
+	int iColumnStart, iColumnCount;		// First column (counting from 1) and number of columns
+	int iNeighbors[LIFE_DIRECTIONS];	// Ranks of the eight neighbouring blocks
+	int iWestColumnCount;				// Columns of the blocks on the left (north west and south west alike)
+	int iEastColumnCount;				// Columns of the blocks on the right (north east and south east alike)
+	int iDepth;							// Rows and columns of the halos
+	int iPeriodic;						// The grid is a torus
+	int *iRowStarts;					// First row of every row of blocks (and one behind the last row)
+	int *iColumnStarts;					// First column of every column of blocks (and one behind the last column)
+};
+
+// Signature of the methods
+int chooseProcessGrid(int iProcesses, int iRowCount, int iColumnCount, int iDepth, int iDims[2]);
+void blockRange(int iCount, int iParts, int iIndex, int &iStart, int &iSize);
+void setBlocks(LifeDomain &domain);
+int tallestBlock(const LifeDomain &domain);
+void blockOf(const LifeDomain &domain, int iRank, int &iRowStart, int &iRowSize, int &iColumnStart, int &iColumnSize);
+int createDomain(LifeDomain &domain, MPI_Comm communicator, int iGlobalRowCount, int iGlobalColumnCount, int iDepth, int iPeriodic);
+void freeDomain(LifeDomain &domain);
+
+#endif
@@ -0,0 +1,491 @@
+/*
+ * The ensembles of the Game of Life: many independent runs in one job.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Including the ensembles, the binary grid file, the RLE pattern file and the parallel output
+#include "life_ensemble.h"
+#include "life_file.h"
+#include "life_rle.h"
+#include "life_io.h"
+
+using namespace std;
+
+// Longest line of the manifest
+#define LIFE_MANIFEST_LINE_SIZE 1024
+
+// Jobs being sorted by planUnits and the limit of their small grids
+static const LifeJob *pPlannedJobs = NULL;
+static long long lPlannedSmallCells = 0;
+
+// Read the jobs of the manifest, their inputs are not looked at yet. Returns the number of jobs (-1 if a line is broken).
+int readManifest(const char *sFileName, LifeJob *&jobs)
+{
+	jobs = NULL;
+	FILE *pFile = fopen(sFileName, "r");
+	if(!pFile)
+	{
+		cerr << "Unable to open " << sFileName << endl;
+		return -1;
+	}
+
+	char sLine[LIFE_MANIFEST_LINE_SIZE];
+	int iJobCount = 0, iCapacity = 0, iLine = 0;
+	while(fgets(sLine, sizeof(sLine), pFile))
+	{
+		iLine++;
+		char *sText = sLine;
+		while(isspace((unsigned char) *sText))
+			sText++;
+		if(*sText == '\0' || *sText == '#')
+			continue;
+
+		if(iJobCount == iCapacity)
+		{
+			iCapacity = iCapacity ? 2 * iCapacity : 64;
+			jobs = (LifeJob *) realloc(jobs, iCapacity * sizeof(LifeJob));
+		}
+
+		// <input_file> <rule|-> <generations> <output_file> [torus|dead]
+		LifeJob &job = jobs[iJobCount];
+		memset(&job, 0, sizeof(LifeJob));
+		char sBoundary[16] = "torus";
+		int iFields = sscanf(sText, "%255s %47s %d %255s %15s", job.sInput, job.sRule, &job.iGenerations, job.sOutput, sBoundary);
+		if(iFields < 4 || job.iGenerations < 0 || !parseBoundary(job.boundary, sBoundary) || job.boundary == LIFE_BOUNDARY_GROW)
+		{
+			cerr << "Line " << iLine << " of " << sFileName << " is no job: <input_file> <rule|-> <generations> <output_file> [torus|dead]" << endl;
+			fclose(pFile);
+			free(jobs);
+			jobs = NULL;
+			return -1;
+		}
+		iJobCount++;
+	}
+
+	fclose(pFile);
+	return iJobCount;
+}
+
+// Read the grid dimension, the generation and the rule of the input of a job, and name its rule as formatRule does.
+// Returns 0 (the job is not valid) if the input can not be read or the rule is not supported.
+int readJobHeader(LifeJob &job)
+{
+	LifeRule rule;
+	createRule(rule);
+	int iRuleGiven = strcmp(job.sRule, "-") != 0;
+	job.iValid = 0;
+	job.uGeneration = 0;
+	job.lRowOrigin = job.lColumnOrigin = job.lHeaderSize = 0;
+
+	if(iRuleGiven && !parseRule(rule, job.sRule))
+	{
+		cerr << "The rule " << job.sRule << " of " << job.sInput << " is not supported" << endl;
+		return 0;
+	}
+
+	if(isLifeFile(job.sInput))
+	{
+		LifeFile file;
+		if(!openLifeFile(file, job.sInput))
+			return 0;
+		job.iRowCount = (int) file.header.uRowCount;
+		job.iColumnCount = (int) file.header.uColumnCount;
+		job.uGeneration = file.header.uGeneration;
+		closeLifeFile(file);
+	}
+	else if(isRleFile(job.sInput))
+	{
+		// An RLE pattern brings its rule along and its place on the plane
+		LifeRle rle;
+		if(!openRle(rle, job.sInput))
+			return 0;
+		job.iRowCount = rle.iRowCount;
+		job.iColumnCount = rle.iColumnCount;
+		job.uGeneration = rle.uGeneration;
+		job.lRowOrigin = rle.lRowOrigin;
+		job.lColumnOrigin = rle.lColumnOrigin;
+		int iRuleValid = iRuleGiven || !rle.sRule[0] || parseRule(rule, rle.sRule);
+		if(!iRuleValid)
+			cerr << "The rule " << rle.sRule << " of " << job.sInput << " is not supported" << endl;
+		closeRle(rle);
+		if(!iRuleValid)
+			return 0;
+	}
+	else
+	{
+		// The grid dimension on the first line of a text input, the rows start behind it
+		FILE *pFile = fopen(job.sInput, "r");
+		if(!pFile)
+		{
+			cerr << "Unable to open " << job.sInput << endl;
+			return 0;
+		}
+		int iRead = fscanf(pFile, "%d %d", &job.iRowCount, &job.iColumnCount), c;
+		while((c = fgetc(pFile)) != EOF && c != '\n')
+			;
+		job.lHeaderSize = ftell(pFile);
+		fclose(pFile);
+		if(iRead != 2)
+		{
+			cerr << "The first line of " << job.sInput << " holds no grid dimension" << endl;
+			return 0;
+		}
+	}
+
+	if(job.iRowCount < 1 || job.iColumnCount < 1)
+	{
+		cerr << "The grid of " << job.sInput << " is empty" << endl;
+		return 0;
+	}
+
+	// The outer layers of a torus are copies of the cells, as deep as the neighbourhood
+	if(job.boundary == LIFE_BOUNDARY_TORUS && (job.iRowCount < rule.iRadius || job.iColumnCount < rule.iRadius))
+	{
+		cerr << "The grid of " << job.sInput << " needs at least " << rule.iRadius << " rows and columns for the rule" << endl;
+		return 0;
+	}
+
+	formatRule(rule, job.sRule);
+	job.iValid = 1;
+	return 1;
+}
+
+// Read the block of a text input of the rows [iFromRow, iFromRow + iRowSize) and the columns [iFromColumn, iFromColumn + iColumnSize)
+// into the dead cells of the grid from the cell (iToRow, iToColumn) on. The cells follow each other row by row, whatever the lines.
+int readTextCells(const char *sFileName, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize)
+{
+	FILE *pFile = fopen(sFileName, "r");
+	if(!pFile)
+	{
+		cerr << "Unable to open " << sFileName << endl;
+		return 0;
+	}
+
+	int iRowCount, iColumnCount;
+	if(fscanf(pFile, "%d %d", &iRowCount, &iColumnCount) != 2 || iColumnCount < 1)
+	{
+		fclose(pFile);
+		return 0;
+	}
+
+	// Only the rows up to the last one of the block are gone through
+	int iRow = 0, iColumn = 0, iRowEnd = iFromRow + iRowSize, iColumnEnd = iFromColumn + iColumnSize, c;
+	while(iRow < iRowEnd && (c = getc(pFile)) != EOF)
+	{
+		if(isspace(c))
+			continue;
+
+		if(c != '0' && iRow >= iFromRow && iColumn >= iFromColumn && iColumn < iColumnEnd)
+			setCell(grid, iToRow + iRow - iFromRow, iToColumn + iColumn - iFromColumn, 1);
+		if(++iColumn == iColumnCount)
+		{
+			iRow++;
+			iColumn = 0;
+		}
+	}
+
+	fclose(pFile);
+	return 1;
+}
+
+// Read the whole grid of the input of a job into the dead cells of the grid from the cell (iToRow, iToColumn) on
+int readJobCells(const LifeJob &job, LifeGrid &grid, int iToRow, int iToColumn)
+{
+	if(isLifeFile(job.sInput))
+	{
+		LifeFile file;
+		if(!openLifeFile(file, job.sInput))
+			return 0;
+
+		int iValid = checksumRows(file, 0, job.iRowCount) == file.header.uChecksum;
+		if(iValid)
+			readRows(file, grid, iToRow, iToColumn, 0, job.iRowCount, 0, job.iColumnCount);
+		else
+			cerr << "The checksum of " << job.sInput << " does not match its grid" << endl;
+		closeLifeFile(file);
+		return iValid;
+	}
+
+	if(isRleFile(job.sInput))
+	{
+		LifeRle rle;
+		if(!openRle(rle, job.sInput))
+			return 0;
+
+		int iValid = readRleCells(rle, grid, iToRow, iToColumn, 0, job.iRowCount, 0, job.iColumnCount);
+		closeRle(rle);
+		return iValid;
+	}
+
+	return readTextCells(job.sInput, grid, iToRow, iToColumn, 0, job.iRowCount, 0, job.iColumnCount);
+}
+
+// Write the last generation of a job, held by the grid with outer layers of iDepth rows and columns, as the serial program
+// does: a binary grid file (".bin"), an RLE pattern (".rle") or text
+int writeJobGrid(const LifeJob &job, const LifeGrid &grid, int iDepth)
+{
+	uint64_t uGeneration = job.uGeneration + job.iGenerations;
+	if(isBinaryOutput(job.sOutput))
+		return writeLifeFile(job.sOutput, grid, iDepth, uGeneration);
+
+	if(isRleOutput(job.sOutput))
+	{
+		LifeRule rule;
+		createRule(rule);
+		parseRule(rule, job.sRule);
+		return writeRleFile(job.sOutput, grid, iDepth, rule, uGeneration, job.lRowOrigin, job.lColumnOrigin);
+	}
+
+	FILE *pFile = fopen(job.sOutput, "w");
+	if(!pFile)
+		return 0;
+
+	// A row is put together first, "0 " or "1 " per cell
+	char *sRow = (char *) malloc(2 * (size_t) job.iColumnCount + 2);
+	for(int i = iDepth; i < iDepth + job.iRowCount; i++)
+	{
+		for(int j = 0; j < job.iColumnCount; j++)
+		{
+			sRow[2 * j] = getCell(grid, i, iDepth + j) ? '1' : '0';
+			sRow[2 * j + 1] = ' ';
+		}
+		sRow[2 * job.iColumnCount] = '\n';
+		fwrite(sRow, 1, 2 * (size_t) job.iColumnCount + 1, pFile);
+	}
+	free(sRow);
+
+	return fclose(pFile) == 0;
+}
+
+// Cells of the grid of a job
+static long long countJobCells(const LifeJob &job)
+{
+	return (long long) job.iRowCount * job.iColumnCount;
+}
+
+// Order of the jobs: the large ones first, the most work first, then the small ones by rule, generations and size
+static int compareJobs(const void *pFirst, const void *pSecond)
+{
+	const LifeJob &first = pPlannedJobs[*(const int *) pFirst], &second = pPlannedJobs[*(const int *) pSecond];
+	int iFirstLarge = countJobCells(first) > lPlannedSmallCells, iSecondLarge = countJobCells(second) > lPlannedSmallCells;
+	if(iFirstLarge != iSecondLarge)
+		return iSecondLarge - iFirstLarge;
+
+	if(iFirstLarge)
+	{
+		double dFirst = (double) countJobCells(first) * first.iGenerations, dSecond = (double) countJobCells(second) * second.iGenerations;
+		return (dFirst < dSecond) - (dFirst > dSecond);
+	}
+
+	int iRule = strcmp(first.sRule, second.sRule);
+	if(iRule)
+		return iRule;
+	if(first.iGenerations != second.iGenerations)
+		return (first.iGenerations > second.iGenerations) - (first.iGenerations < second.iGenerations);
+	return (countJobCells(first) > countJobCells(second)) - (countJobCells(first) < countJobCells(second));
+}
+
+// Cut the valid jobs into units: every grid of more than lSmallCells cells on its own, the small grids into batches of up to
+// iBatch grids of the same rule. iOrder gets the jobs in the order of the units. Returns the number of units.
+int planUnits(const LifeJob *jobs, int iJobCount, long long lSmallCells, int iBatch, int *&iOrder, LifeUnit *&units)
+{
+	iOrder = (int *) malloc((iJobCount + 1) * sizeof(int));
+	units = (LifeUnit *) malloc((iJobCount + 1) * sizeof(LifeUnit));
+
+	int iValidCount = 0;
+	for(int k = 0; k < iJobCount; k++)
+		if(jobs[k].iValid)
+			iOrder[iValidCount++] = k;
+
+	pPlannedJobs = jobs;
+	lPlannedSmallCells = lSmallCells;
+	qsort(iOrder, iValidCount, sizeof(int), compareJobs);
+	pPlannedJobs = NULL;
+
+	int iUnitCount = 0;
+	for(int k = 0; k < iValidCount; k++)
+	{
+		const LifeJob &job = jobs[iOrder[k]];
+		int iLarge = countJobCells(job) > lSmallCells;
+
+		// A batch takes the next small grid while it has room and the grid has its rule
+		if(!iLarge && iUnitCount > 0 && !units[iUnitCount - 1].iLarge && units[iUnitCount - 1].iCount < iBatch
+		   && strcmp(jobs[iOrder[units[iUnitCount - 1].iFirst]].sRule, job.sRule) == 0)
+		{
+			units[iUnitCount - 1].iCount++;
+			continue;
+		}
+
+		units[iUnitCount].iFirst = k;
+		units[iUnitCount].iCount = 1;
+		units[iUnitCount].iLarge = iLarge;
+		iUnitCount++;
+	}
+
+	return iUnitCount;
+}
+
+// Order of the boards in a sheet: the tallest first
+static int compareBoards(const void *pFirst, const void *pSecond)
+{
+	const LifeBoard &first = *(const LifeBoard *) pFirst, &second = *(const LifeBoard *) pSecond;
+	if(first.iRowCount != second.iRowCount)
+		return (first.iRowCount < second.iRowCount) - (first.iRowCount > second.iRowCount);
+	return (first.iJob > second.iJob) - (first.iJob < second.iJob);
+}
+
+// Pack the grids of the jobs iJobs[0] .. iJobs[iBoardCount - 1] with outer layers of iDepth rows and columns into a sheet:
+// the tallest first, side by side into shelves of LIFE_ENSEMBLE_SHEET_COLUMNS columns. The cells are all dead.
+void packSheet(LifeSheet &sheet, const LifeJob *jobs, const int *iJobs, int iBoardCount, int iDepth)
+{
+	sheet.iDepth = iDepth;
+	sheet.iBoardCount = iBoardCount;
+	sheet.boards = (LifeBoard *) malloc(iBoardCount * sizeof(LifeBoard));
+	sheet.iShelfStarts = (int *) malloc((iBoardCount + 1) * sizeof(int));
+
+	int iWidth = LIFE_ENSEMBLE_SHEET_COLUMNS;
+	for(int b = 0; b < iBoardCount; b++)
+	{
+		const LifeJob &job = jobs[iJobs[b]];
+		LifeBoard &board = sheet.boards[b];
+		board.iJob = iJobs[b];
+		board.iRowCount = job.iRowCount;
+		board.iColumnCount = job.iColumnCount;
+		board.iTorus = job.boundary == LIFE_BOUNDARY_TORUS;
+		if(board.iColumnCount + 2 * iDepth > iWidth)
+			iWidth = board.iColumnCount + 2 * iDepth;
+	}
+	qsort(sheet.boards, iBoardCount, sizeof(LifeBoard), compareBoards);
+
+	// A board goes right of the last one of the shelf, or starts the next shelf below the tallest board of the shelf
+	int iRow = 0, iColumn = 0, iShelfRows = 0, iUsedColumns = 1;
+	sheet.iShelfCount = 0;
+	for(int b = 0; b < iBoardCount; b++)
+	{
+		LifeBoard &board = sheet.boards[b];
+		int iBoardRows = board.iRowCount + 2 * iDepth, iBoardColumns = board.iColumnCount + 2 * iDepth;
+		if(b == 0 || iColumn + iBoardColumns > iWidth)
+		{
+			sheet.iShelfStarts[sheet.iShelfCount++] = b;
+			iRow += iShelfRows;
+			iColumn = iShelfRows = 0;
+		}
+
+		board.iRow = iRow;
+		board.iColumn = iColumn;
+		iColumn += iBoardColumns;
+		if(iBoardRows > iShelfRows)
+			iShelfRows = iBoardRows;
+		if(iColumn > iUsedColumns)
+			iUsedColumns = iColumn;
+	}
+	sheet.iShelfStarts[sheet.iShelfCount] = iBoardCount;
+
+	allocateGrid(sheet.grid, iRow + iShelfRows, iUsedColumns);
+	allocateGrid(sheet.gridNew, iRow + iShelfRows, iUsedColumns);
+}
+
+// Make the outer layers of a board of the sheet: copies of its cells around a torus, dead cells otherwise.
+// The words of the rows are shared with the other boards of the shelf, only the bits of the board are touched.
+void addBoardLayers(LifeGrid &grid, const LifeBoard &board, int iDepth)
+{
+	int iRowStart = board.iRow + iDepth, iRowEnd = iRowStart + board.iRowCount;
+	int iColumn = board.iColumn, iColumnSize = board.iColumnCount, iWidth = iColumnSize + 2 * iDepth;
+
+	if(!board.iTorus)
+	{
+		for(int i = 0; i < iDepth; i++)
+		{
+			clearBits(getRow(grid, board.iRow + i), iColumn, iWidth);
+			clearBits(getRow(grid, iRowEnd + i), iColumn, iWidth);
+		}
+		for(int i = iRowStart; i < iRowEnd; i++)
+		{
+			clearBits(getRow(grid, i), iColumn, iDepth);
+			clearBits(getRow(grid, i), iColumn + iDepth + iColumnSize, iDepth);
+		}
+		return;
+	}
+
+	// Left layers are the copy of the last columns, right layers the copy of the first columns
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		LifeWord *uRow = getRow(grid, i);
+		copyBits(uRow, iColumn, uRow, iColumn + iColumnSize, iDepth);
+		copyBits(uRow, iColumn + iDepth + iColumnSize, uRow, iColumn + iDepth, iDepth);
+	}
+
+	// Top layers are the copy of the last rows, bottom layers the copy of the first rows, the corners come along
+	for(int i = 0; i < iDepth; i++)
+	{
+		copyBits(getRow(grid, board.iRow + i), iColumn, getRow(grid, iRowEnd - iDepth + i), iColumn, iWidth);
+		copyBits(getRow(grid, iRowEnd + i), iColumn, getRow(grid, iRowStart + i), iColumn, iWidth);
+	}
+}
+
+// Copy a board of the sheet with its outer layers into a grid of its own (allocated here)
+void copyBoard(LifeGrid &gridTo, const LifeSheet &sheet, const LifeBoard &board)
+{
+	int iRowSize = board.iRowCount + 2 * sheet.iDepth, iColumnSize = board.iColumnCount + 2 * sheet.iDepth;
+	allocateGrid(gridTo, iRowSize, iColumnSize);
+	copyBlock(gridTo, 0, 0, sheet.grid, board.iRow, board.iColumn, iRowSize, iColumnSize);
+}
+
+// Free the sheet
+void freeSheet(LifeSheet &sheet)
+{
+	freeGrid(sheet.grid);
+	freeGrid(sheet.gridNew);
+	free(sheet.boards);
+	free(sheet.iShelfStarts);
+}
+
+// Create the counter of the units on process 0, for the groups of groupComm. Collective: all processes call it.
+void createQueue(LifeQueue &queue, MPI_Comm groupComm)
+{
+	int iWorldRank, iGroupRank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &iWorldRank);
+	MPI_Comm_rank(groupComm, &iGroupRank);
+	queue.groupComm = groupComm;
+	queue.iLeader = iGroupRank == 0;
+
+	MPI_Win_allocate((iWorldRank == 0) ? sizeof(int) : 0, sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &queue.iNext, &queue.win);
+	if(iWorldRank == 0)
+	{
+		MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, queue.win);
+		*queue.iNext = 0;
+		MPI_Win_unlock(0, queue.win);
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+}
+
+// Take the next unit for the group: its first process increments the counter, the others learn the unit from it.
+// Collective over the group. Returns the index of the unit (as many as there are units once they are all taken).
+int takeUnit(LifeQueue &queue)
+{
+	int iUnit = 0, iOne = 1;
+	if(queue.iLeader)
+	{
+		MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, queue.win);
+		MPI_Fetch_and_op(&iOne, &iUnit, MPI_INT, 0, 0, MPI_SUM, queue.win);
+		MPI_Win_unlock(0, queue.win);
+	}
+	MPI_Bcast(&iUnit, 1, MPI_INT, 0, queue.groupComm);
+	return iUnit;
+}
+
+// Free the counter. Collective: all processes call it.
+void freeQueue(LifeQueue &queue)
+{
+	MPI_Win_free(&queue.win);
+}
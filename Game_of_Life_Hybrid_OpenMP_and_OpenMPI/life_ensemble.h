@@ -0,0 +1,131 @@
+/*
+ * The ensembles of the Game of Life: many independent runs in one job.
+ *
+ * A manifest lists the runs (the jobs), one per line:
+ *
+ *		# <input_file> <rule|-> <generations> <output_file> [torus|dead]
+ *		soup_1.txt B3/S23 1000 soup_1.out.txt
+ *		soup_2.rle - 1000 soup_2.out.rle dead
+ *
+ * "-" takes the rule of an RLE pattern (the Game of Life otherwise). Blank
+ * lines and the lines starting with '#' are left out. Process 0 reads the
+ * manifest and the headers of all inputs and broadcasts the jobs.
+ *
+ * The processes form groups of iGroupSize (MPI_Comm_split). The jobs are cut
+ * into units (planUnits): a large grid is a unit of its own, computed by all
+ * processes of a group as blocks with halos (life_domain.h), the small grids
+ * of a rule are batched into units of iBatch grids for every process of a
+ * group. The units go to the groups from a shared work queue: a counter on
+ * process 0 which the first process of a group fetches and increments
+ * (MPI_Fetch_and_op) whenever its group is done with a unit, so the groups
+ * finishing early take more of them. Large units come first, the largest
+ * first.
+ *
+ * The small grids of a process are packed into one grid, the sheet
+ * (packSheet): side by side in shelves, each one with outer layers of its
+ * own, as tightly as the bits go. One kernel call over the rows of the sheet
+ * computes all of them at once, the vectors of the kernels run across the
+ * boards. After every generation the outer layers of every board are made
+ * again (addBoardLayers): whatever the kernel wrote there came from the
+ * neighbouring boards. The boards of a shelf share the words of their rows,
+ * the shelves share none: the threads make the layers shelf by shelf.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#if !defined LIFE_ENSEMBLE_H
+#define LIFE_ENSEMBLE_H
+
+// Including libraries
+#include <mpi.h>
+#include <stdint.h>
+
+// Including the bit-packed grid, its rules and boundaries
+#include "life_grid.h"
+#include "life_rule.h"
+#include "life_bounds.h"
+
+// Longest name of an input or an output file
+#define LIFE_JOB_NAME_SIZE 256
+
+// Largest grid packed into a sheet unless given otherwise (cells)
+#define LIFE_ENSEMBLE_SMALL_CELLS (1 << 20)
+
+// Grids of a batch for every process of a group unless given otherwise
+#define LIFE_ENSEMBLE_BATCH 64
+
+// Columns of a sheet (unless a board is wider)
+#define LIFE_ENSEMBLE_SHEET_COLUMNS 4096
+
+// A run of the ensemble
+struct LifeJob
+{
+	char sInput[LIFE_JOB_NAME_SIZE];
+	char sOutput[LIFE_JOB_NAME_SIZE];
+	char sRule[LIFE_RULE_NAME_SIZE];	// Rule of the manifest or of the RLE pattern (as formatRule names it)
+	int iGenerations;
+	LifeBoundary boundary;
+	int iRowCount, iColumnCount;		// Grid dimension of the input
+	uint64_t uGeneration;				// Generation of the input
+	long long lRowOrigin;				// Place of an RLE pattern on the plane
+	long long lColumnOrigin;
+	long long lHeaderSize;				// Bytes of the first line of a text input
+	int iValid;							// The input and its rule are fine
+};
+
+// Jobs handed out at once: a large grid, or a batch of small grids of one rule (iOrder[iFirst] .. iOrder[iFirst + iCount - 1])
+struct LifeUnit
+{
+	int iFirst;
+	int iCount;
+	int iLarge;
+};
+
+// A small grid in a sheet
+struct LifeBoard
+{
+	int iJob;
+	int iRow, iColumn;					// Cell of the sheet of the first cell of the outer layers
+	int iRowCount, iColumnCount;		// Grid dimension without the outer layers
+	int iTorus;
+};
+
+// Small grids computed together
+struct LifeSheet
+{
+	LifeGrid grid;
+	LifeGrid gridNew;
+	int iDepth;							// Rows and columns of the outer layers of every board
+	int iBoardCount;
+	LifeBoard *boards;					// In the order of the shelves
+	int iShelfCount;
+	int *iShelfStarts;					// First board of every shelf (and one behind the last board)
+};
+
+// Shared counter of the units handed out
+struct LifeQueue
+{
+	MPI_Win win;
+	int *iNext;							// The counter (on process 0 of MPI_COMM_WORLD)
+	MPI_Comm groupComm;					// Group taking the units
+	int iLeader;						// The process takes the units for its group
+};
+
+// Signature of the methods
+int readManifest(const char *sFileName, LifeJob *&jobs);
+int readJobHeader(LifeJob &job);
+int readTextCells(const char *sFileName, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize);
+int readJobCells(const LifeJob &job, LifeGrid &grid, int iToRow, int iToColumn);
+int writeJobGrid(const LifeJob &job, const LifeGrid &grid, int iDepth);
+int planUnits(const LifeJob *jobs, int iJobCount, long long lSmallCells, int iBatch, int *&iOrder, LifeUnit *&units);
+void packSheet(LifeSheet &sheet, const LifeJob *jobs, const int *iJobs, int iBoardCount, int iDepth);
+void addBoardLayers(LifeGrid &grid, const LifeBoard &board, int iDepth);
+void copyBoard(LifeGrid &gridTo, const LifeSheet &sheet, const LifeBoard &board);
+void freeSheet(LifeSheet &sheet);
+void createQueue(LifeQueue &queue, MPI_Comm groupComm);
+int takeUnit(LifeQueue &queue);
+void freeQueue(LifeQueue &queue);
+
+#endif
@@ -0,0 +1,271 @@
+/*
+ * The binary grid file of the Game of Life.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Including the binary grid file
+#include "life_file.h"
+
+using namespace std;
+
+// The numbers of the file are little-endian: a big-endian host swaps their bytes
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LIFE_FILE_SWAP 1
+#else
+#define LIFE_FILE_SWAP 0
+#endif
+
+// Swap the bytes of the numbers of the header on a big-endian host, the same swap both ways
+static void swapHeader(LifeFileHeader &header)
+{
+#if LIFE_FILE_SWAP
+	header.uMagic = __builtin_bswap32(header.uMagic);
+	header.uVersion = __builtin_bswap32(header.uVersion);
+	header.uEncoding = __builtin_bswap32(header.uEncoding);
+	header.uHeaderSize = __builtin_bswap32(header.uHeaderSize);
+	header.uRowCount = __builtin_bswap64(header.uRowCount);
+	header.uColumnCount = __builtin_bswap64(header.uColumnCount);
+	header.uGeneration = __builtin_bswap64(header.uGeneration);
+	header.uChecksum = __builtin_bswap64(header.uChecksum);
+#else
+	(void) header;
+#endif
+}
+
+// Put the header into the sizeof(LifeFileHeader) bytes of the file
+void storeHeader(const LifeFileHeader &header, unsigned char *cBytes)
+{
+	LifeFileHeader headerFile = header;
+	swapHeader(headerFile);
+	memcpy(cBytes, &headerFile, sizeof(LifeFileHeader));
+}
+
+// Take the header from the bytes of the file
+void loadHeader(LifeFileHeader &header, const unsigned char *cBytes)
+{
+	memcpy(&header, cBytes, sizeof(LifeFileHeader));
+	swapHeader(header);
+}
+
+// Whether the file starts with the magic of the binary format
+int isLifeFile(const char *sFileName)
+{
+	unsigned char cMagic[4];
+	FILE *pFile = fopen(sFileName, "rb");
+	if(!pFile)
+		return 0;
+
+	size_t iRead = fread(cMagic, sizeof(cMagic), 1, pFile);
+	fclose(pFile);
+
+	uint32_t uMagic = cMagic[0] | (uint32_t) cMagic[1] << 8 | (uint32_t) cMagic[2] << 16 | (uint32_t) cMagic[3] << 24;
+	return iRead == 1 && uMagic == LIFE_FILE_MAGIC;
+}
+
+// Map the file into memory and check its header. Returns 0 (with a message) when the file is unusable.
+int openLifeFile(LifeFile &file, const char *sFileName)
+{
+	file.pMapping = NULL;
+
+	int iDescriptor = open(sFileName, O_RDONLY);
+	if(iDescriptor < 0)
+	{
+		cerr << "Unable to open " << sFileName << endl;
+		return 0;
+	}
+
+	struct stat fileStatus;
+	if(fstat(iDescriptor, &fileStatus) != 0 || (size_t) fileStatus.st_size < sizeof(LifeFileHeader))
+	{
+		cerr << sFileName << " is too short for a grid file" << endl;
+		close(iDescriptor);
+		return 0;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	file.iMappingSize = fileStatus.st_size;
+	file.pMapping = mmap(NULL, file.iMappingSize, PROT_READ, MAP_PRIVATE, iDescriptor, 0);
+	close(iDescriptor);
+	if(file.pMapping == MAP_FAILED)
+	{
+		cerr << "Unable to map " << sFileName << endl;
+		file.pMapping = NULL;
+		return 0;
+	}
+
+	loadHeader(file.header, (const unsigned char *) file.pMapping);
+	const LifeFileHeader &header = file.header;
+	file.cRows = (const unsigned char *) file.pMapping + header.uHeaderSize;
+
+	const char *sError = NULL;
+	if(header.uMagic != LIFE_FILE_MAGIC)
+		sError = "is not a grid file";
+	else if(header.uVersion != LIFE_FILE_VERSION)
+		sError = "has an unknown version";
+	else if(header.uEncoding != LIFE_ENCODING_BITS)
+		sError = "has an unknown encoding";
+	else if(header.uHeaderSize < sizeof(LifeFileHeader) || header.uRowCount == 0 || header.uColumnCount == 0
+			|| header.uRowCount > INT32_MAX || header.uColumnCount > INT32_MAX)
+		sError = "has a broken header";
+	else if(file.iMappingSize != header.uHeaderSize + header.uRowCount * lifeRowBytes((int) header.uColumnCount))
+		sError = "does not match the size of its grid";
+
+	if(sError)
+	{
+		cerr << sFileName << " " << sError << endl;
+		closeLifeFile(file);
+		return 0;
+	}
+
+	return 1;
+}
+
+// Unmap the file
+void closeLifeFile(LifeFile &file)
+{
+	if(file.pMapping)
+		munmap(file.pMapping, file.iMappingSize);
+	file.pMapping = NULL;
+}
+
+// Checksum of the row uRow (FNV-1a, 64 bit, seeded with the index of the row)
+uint64_t checksumRow(const unsigned char *cRow, size_t iRowBytes, uint64_t uRow)
+{
+	uint64_t uHash = 14695981039346656037ull ^ uRow;
+
+	for(size_t k = 0; k < iRowBytes; k++)
+	{
+		uHash ^= cRow[k];
+		uHash *= 1099511628211ull;
+	}
+
+	return uHash;
+}
+
+// Checksum of the rows [iRowStart, iRowEnd) of the file
+uint64_t checksumRows(const LifeFile &file, int iRowStart, int iRowEnd)
+{
+	size_t iRowBytes = lifeRowBytes((int) file.header.uColumnCount);
+	uint64_t uChecksum = 0;
+
+	for(int i = iRowStart; i < iRowEnd; i++)
+		uChecksum += checksumRow(file.cRows + i * iRowBytes, iRowBytes, (uint64_t) i);
+
+	return uChecksum;
+}
+
+// Unpack iRowSize * iColumnSize cells of the file (from row iFromRow and column iFromColumn, counting from 0)
+// into the grid at row iToRow and column iToColumn
+void readRows(const LifeFile &file, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize)
+{
+	size_t iRowBytes = lifeRowBytes((int) file.header.uColumnCount);
+
+	// The bytes of the cells are gathered into words first (one more word for copyBits to read behind them)
+	int iFirstByte = iFromColumn / 8;
+	int iLastByte = (iFromColumn + iColumnSize - 1) / 8;
+	int iWords = (iLastByte - iFirstByte) / 8 + 2;
+	LifeWord *uBuffer = (LifeWord *) calloc(iWords, sizeof(LifeWord));
+
+	for(int i = 0; i < iRowSize; i++)
+	{
+		const unsigned char *cRow = file.cRows + (size_t) (iFromRow + i) * iRowBytes;
+		for(int k = iFirstByte; k <= iLastByte; k++)
+		{
+			int iByte = k - iFirstByte;
+			if(iByte % 8 == 0)
+				uBuffer[iByte / 8] = 0;
+			uBuffer[iByte / 8] |= (LifeWord) cRow[k] << (8 * (iByte % 8));
+		}
+
+		copyBits(getRow(grid, iToRow + i), iToColumn, uBuffer, iFromColumn % 8, iColumnSize);
+	}
+
+	free(uBuffer);
+}
+
+// Pack iColumnSize cells of row i of the grid (from column iFromColumn) into the bytes of a file row, a word at a time
+// (the bytes of a little-endian word are the bytes of the file, a big-endian host swaps them first)
+void packRow(const LifeGrid &grid, int i, int iFromColumn, int iColumnSize, unsigned char *cRow)
+{
+	const LifeWord *uRow = getRow(grid, i);
+	int iRowBytes = (int) lifeRowBytes(iColumnSize);
+
+	for(int k = 0; k < iRowBytes; k += (int) sizeof(LifeWord))
+	{
+		// 64 cells from bit (iFromColumn + 8 k) on, the padding behind the row keeps the next word readable
+		int iBit = iFromColumn + 8 * k;
+		LifeWord uBits = uRow[iBit / LIFE_WORD_BITS] >> (iBit % LIFE_WORD_BITS);
+		if(iBit % LIFE_WORD_BITS)
+			uBits |= uRow[iBit / LIFE_WORD_BITS + 1] << (LIFE_WORD_BITS - iBit % LIFE_WORD_BITS);
+
+		// Cells behind the last one are dead
+		int iRemaining = iColumnSize - 8 * k;
+		if(iRemaining < LIFE_WORD_BITS)
+			uBits &= ((LifeWord) 1 << iRemaining) - 1;
+
+#if LIFE_FILE_SWAP
+		uBits = __builtin_bswap64(uBits);
+#endif
+		memcpy(cRow + k, &uBits, (iRowBytes - k < (int) sizeof(LifeWord)) ? iRowBytes - k : sizeof(LifeWord));
+	}
+}
+
+// Header of a grid file (the checksum is filled in once the rows are known)
+void initHeader(LifeFileHeader &header, int iRowCount, int iColumnCount, uint64_t uGeneration)
+{
+	memset(&header, 0, sizeof(header));
+	header.uMagic = LIFE_FILE_MAGIC;
+	header.uVersion = LIFE_FILE_VERSION;
+	header.uEncoding = LIFE_ENCODING_BITS;
+	header.uHeaderSize = sizeof(LifeFileHeader);
+	header.uRowCount = iRowCount;
+	header.uColumnCount = iColumnCount;
+	header.uGeneration = uGeneration;
+}
+
+// Write the grid (without the outer layers of iDepth rows and columns) to a grid file. Returns 0 when the file can not be written.
+int writeLifeFile(const char *sFileName, const LifeGrid &grid, int iDepth, uint64_t uGeneration)
+{
+	int iRowCount = grid.iRowCount - 2 * iDepth, iColumnCount = grid.iColumnCount - 2 * iDepth;
+	size_t iRowBytes = lifeRowBytes(iColumnCount);
+
+	FILE *pFile = fopen(sFileName, "wb");
+	if(!pFile)
+		return 0;
+
+	LifeFileHeader header;
+	initHeader(header, iRowCount, iColumnCount, uGeneration);
+
+	// The header is written again with the checksum at the end
+	unsigned char cHeader[sizeof(LifeFileHeader)];
+	storeHeader(header, cHeader);
+	fwrite(cHeader, 1, sizeof(cHeader), pFile);
+
+	unsigned char *cRow = (unsigned char *) malloc(iRowBytes);
+	for(int i = 0; i < iRowCount; i++)
+	{
+		packRow(grid, i + iDepth, iDepth, iColumnCount, cRow);
+		header.uChecksum += checksumRow(cRow, iRowBytes, (uint64_t) i);
+		fwrite(cRow, 1, iRowBytes, pFile);
+	}
+	free(cRow);
+
+	fseek(pFile, 0, SEEK_SET);
+	storeHeader(header, cHeader);
+	fwrite(cHeader, 1, sizeof(cHeader), pFile);
+
+	return fclose(pFile) == 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * The binary grid file of the Game of Life.
+ *
+ * A fixed header of 48 bytes is followed by the bit-packed rows:
+ *
+ *		uMagic			"LIFE"
+ *		uVersion		version of the format (LIFE_FILE_VERSION)
+ *		uEncoding		encoding of the rows (LifeEncoding)
+ *		uHeaderSize		bytes in front of the first row
+ *		uRowCount		rows of the grid
+ *		uColumnCount	columns of the grid
+ *		uGeneration		generation the grid belongs to
+ *		uChecksum		checksum of the rows (checksumRow summed over the rows)
+ *
+ * With LIFE_ENCODING_BITS every row takes (uColumnCount + 7) / 8 bytes and
+ * cell j is bit (j % 8) of byte (j / 8). All numbers are little-endian:
+ * storeHeader and loadHeader convert the header from and to the byte order of
+ * the host, and packRow puts the bytes of the words in the order of the file,
+ * so the files move between hosts of either byte order.
+ *
+ * The file is mapped into memory (mmap) and the rows are unpacked straight
+ * from the mapping, so nothing is parsed. The checksum of a row depends on its
+ * index, and the checksum of the file is the sum of them: every process can
+ * add up the rows it owns.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+#if !defined LIFE_FILE_H
+#define LIFE_FILE_H
+
+// Including libraries
+#include <stdint.h>
+#include <stddef.h>
+
+// Including the bit-packed grid
+#include "life_grid.h"
+
+// "LIFE" in the first four bytes
+#define LIFE_FILE_MAGIC 0x4546494cu
+#define LIFE_FILE_VERSION 1
+
+// Encodings of the rows
+enum LifeEncoding
+{
+	LIFE_ENCODING_BITS = 0		// Bit-packed rows padded to whole bytes
+};
+
+// Header at the start of the file
+struct LifeFileHeader
+{
+	uint32_t uMagic;
+	uint32_t uVersion;
+	uint32_t uEncoding;
+	uint32_t uHeaderSize;
+	uint64_t uRowCount;
+	uint64_t uColumnCount;
+	uint64_t uGeneration;
+	uint64_t uChecksum;
+};
+
+// A binary grid file mapped into memory
+struct LifeFile
+{
+	LifeFileHeader header;
+	const unsigned char *cRows;	// First row in the mapping
+	void *pMapping;
+	size_t iMappingSize;
+};
+
+// Bytes of a packed row of the file
+inline size_t lifeRowBytes(int iColumnCount)
+{
+	return ((size_t) iColumnCount + 7) / 8;
+}
+
+// Signature of the methods
+int isLifeFile(const char *sFileName);
+int openLifeFile(LifeFile &file, const char *sFileName);
+void closeLifeFile(LifeFile &file);
+uint64_t checksumRow(const unsigned char *cRow, size_t iRowBytes, uint64_t uRow);
+uint64_t checksumRows(const LifeFile &file, int iRowStart, int iRowEnd);
+void readRows(const LifeFile &file, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize);
+void packRow(const LifeGrid &grid, int i, int iFromColumn, int iColumnSize, unsigned char *cRow);
+void initHeader(LifeFileHeader &header, int iRowCount, int iColumnCount, uint64_t uGeneration);
+void storeHeader(const LifeFileHeader &header, unsigned char *cBytes);
+void loadHeader(LifeFileHeader &header, const unsigned char *cBytes);
+int writeLifeFile(const char *sFileName, const LifeGrid &grid, int iDepth, uint64_t uGeneration);
+
+#endif
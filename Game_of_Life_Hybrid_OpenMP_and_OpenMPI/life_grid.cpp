@@ -0,0 +1,255 @@
+/*
+ * The bit-packed grid of the Game of Life.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.4 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+// Including the bit-packed grid and its kernels
+#include "life_grid.h"
+#include "life_kernel.h"
+#include "life_radius.h"
+
+using namespace std;
+
+// Allocate the grid without touching its memory: the cells are undefined until the grid is cleared
+void allocateGridUntouched(LifeGrid &grid, int iRowSize, int iColumnSize)
+{
+	grid.iRowCount = iRowSize;
+	grid.iColumnCount = iColumnSize;
+	grid.iWordCount = (iColumnSize + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS;
+
+	// At least one dead word behind every row, rounded up to whole cache lines
+	grid.iStride = ((grid.iWordCount + LIFE_LINE_WORDS) / LIFE_LINE_WORDS) * LIFE_LINE_WORDS;
+
+	// One dead cache line in front of the first row
+	size_t iWords = LIFE_LINE_WORDS + (size_t) iRowSize * grid.iStride;
+	void *pCells = NULL;
+	if(posix_memalign(&pCells, LIFE_LINE_WORDS * sizeof(LifeWord), iWords * sizeof(LifeWord)) != 0)
+	{
+		cerr << "Unable to allocate a grid of " << iRowSize << " * " << iColumnSize << endl;
+		abort();
+	}
+
+	grid.uCells = (LifeWord *) pCells;
+}
+
+// Allocate the grid, every cell (and the outer layers) starts dead
+void allocateGrid(LifeGrid &grid, int iRowSize, int iColumnSize)
+{
+	allocateGridUntouched(grid, iRowSize, iColumnSize);
+	memset(grid.uCells, 0, (LIFE_LINE_WORDS + (size_t) iRowSize * grid.iStride) * sizeof(LifeWord));
+}
+
+// Free the grid
+void freeGrid(LifeGrid &grid)
+{
+	free(grid.uCells);
+	grid.uCells = NULL;
+}
+
+// Copy routine to gridTo from gridFrom (both of the same dimension)
+void copyGrid(LifeGrid &gridTo, const LifeGrid &gridFrom)
+{
+	memcpy(gridTo.uCells, gridFrom.uCells, (LIFE_LINE_WORDS + (size_t) gridFrom.iRowCount * gridFrom.iStride) * sizeof(LifeWord));
+}
+
+// The new generation becomes the current one by exchanging the storage of both grids
+void swapGrids(LifeGrid &grid, LifeGrid &gridNew)
+{
+	LifeWord *uCells = grid.uCells;
+	grid.uCells = gridNew.uCells;
+	gridNew.uCells = uCells;
+}
+
+// Add outer layers to the grid: the grid wraps around as a torus
+void addOuterLayers(LifeGrid &grid)
+{
+	// Add top layer which is the copy of the last row, and bottom layer which is the copy of the first row
+	memcpy(getRow(grid, 0), getRow(grid, grid.iRowCount - 2), grid.iWordCount * sizeof(LifeWord));
+	memcpy(getRow(grid, grid.iRowCount - 1), getRow(grid, 1), grid.iWordCount * sizeof(LifeWord));
+
+	// Left and right layers, the diagonal copies come along with the top and bottom layers
+	addOuterColumns(grid, 0, grid.iRowCount);
+}
+
+// Add outer layers of iDepth rows and columns to the grid (the cells being the rows and columns iDepth .. iRowCount - iDepth - 1
+// and iDepth .. iColumnCount - iDepth - 1, at least iDepth of each): the grid wraps around as a torus
+void addDeepOuterLayers(LifeGrid &grid, int iDepth)
+{
+	int iRowSize = grid.iRowCount - 2 * iDepth, iColumnSize = grid.iColumnCount - 2 * iDepth;
+
+	// Left layers are the copy of the last columns, right layers the copy of the first columns
+	for(int i = iDepth; i < iDepth + iRowSize; i++)
+	{
+		LifeWord *uRow = getRow(grid, i);
+		copyBits(uRow, 0, uRow, iColumnSize, iDepth);
+		copyBits(uRow, iDepth + iColumnSize, uRow, iDepth, iDepth);
+	}
+
+	// Top layers are the copy of the last rows, bottom layers the copy of the first rows, the corners come along
+	for(int i = 0; i < iDepth; i++)
+	{
+		memcpy(getRow(grid, i), getRow(grid, iRowSize + i), grid.iWordCount * sizeof(LifeWord));
+		memcpy(getRow(grid, iDepth + iRowSize + i), getRow(grid, iDepth + i), grid.iWordCount * sizeof(LifeWord));
+	}
+}
+
+// Add left and right layers to the rows [iRowStart, iRowEnd)
+void addOuterColumns(LifeGrid &grid, int iRowStart, int iRowEnd)
+{
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		// Left layer is the copy of the last column, right layer is the copy of the first column
+		setCell(grid, i, 0, getCell(grid, i, grid.iColumnCount - 2));
+		setCell(grid, i, grid.iColumnCount - 1, getCell(grid, i, 1));
+	}
+}
+
+// Copy iBitCount cells of a row starting at bit iFromBit to another row starting at bit iToBit
+void copyBits(LifeWord *uTo, int iToBit, const LifeWord *uFrom, int iFromBit, int iBitCount)
+{
+	while(iBitCount > 0)
+	{
+		// As many bits as fit into the current word of the destination
+		int iOffset = iToBit % LIFE_WORD_BITS;
+		int iBits = LIFE_WORD_BITS - iOffset;
+		if(iBits > iBitCount)
+			iBits = iBitCount;
+
+		// 64 bits of the source from iFromBit on (the padding behind a row keeps the second word readable)
+		int iFromOffset = iFromBit % LIFE_WORD_BITS;
+		LifeWord uBits = uFrom[iFromBit / LIFE_WORD_BITS] >> iFromOffset;
+		if(iFromOffset)
+			uBits |= uFrom[iFromBit / LIFE_WORD_BITS + 1] << (LIFE_WORD_BITS - iFromOffset);
+
+		LifeWord uMask = (iBits == LIFE_WORD_BITS) ? ~(LifeWord) 0 : (((LifeWord) 1 << iBits) - 1);
+		LifeWord &uWord = uTo[iToBit / LIFE_WORD_BITS];
+		uWord = (uWord & ~(uMask << iOffset)) | ((uBits & uMask) << iOffset);
+
+		iToBit += iBits;
+		iFromBit += iBits;
+		iBitCount -= iBits;
+	}
+}
+
+// Kill iBitCount cells of a row starting at bit iBit
+void clearBits(LifeWord *uRow, int iBit, int iBitCount)
+{
+	for(int iEnd = iBit + iBitCount; iBit < iEnd; )
+	{
+		int iOffset = iBit % LIFE_WORD_BITS;
+		int iBits = (LIFE_WORD_BITS - iOffset < iEnd - iBit) ? LIFE_WORD_BITS - iOffset : iEnd - iBit;
+		LifeWord uMask = (iBits == LIFE_WORD_BITS) ? ~(LifeWord) 0 : (((LifeWord) 1 << iBits) - 1);
+		uRow[iBit / LIFE_WORD_BITS] &= ~(uMask << iOffset);
+		iBit += iBits;
+	}
+}
+
+// Bring iBitCount cells of a row to life starting at bit iBit
+void setBits(LifeWord *uRow, int iBit, int iBitCount)
+{
+	for(int iEnd = iBit + iBitCount; iBit < iEnd; )
+	{
+		int iOffset = iBit % LIFE_WORD_BITS;
+		int iBits = (LIFE_WORD_BITS - iOffset < iEnd - iBit) ? LIFE_WORD_BITS - iOffset : iEnd - iBit;
+		LifeWord uMask = (iBits == LIFE_WORD_BITS) ? ~(LifeWord) 0 : (((LifeWord) 1 << iBits) - 1);
+		uRow[iBit / LIFE_WORD_BITS] |= uMask << iOffset;
+		iBit += iBits;
+	}
+}
+
+// Copy a block of iRowSize * iColumnSize cells between two grids
+void copyBlock(LifeGrid &gridTo, int iToRow, int iToColumn, const LifeGrid &gridFrom, int iFromRow, int iFromColumn, int iRowSize, int iColumnSize)
+{
+	for(int i = 0; i < iRowSize; i++)
+		copyBits(getRow(gridTo, iToRow + i), iToColumn, getRow(gridFrom, iFromRow + i), iFromColumn, iColumnSize);
+}
+
+// Mask of the cells of word w lying between the left and right layer
+static LifeWord interiorMask(const LifeGrid &grid, int w)
+{
+	int iLow = w * LIFE_WORD_BITS, iHigh = iLow + LIFE_WORD_BITS - 1;
+
+	if(iLow < 1)
+		iLow = 1;
+	if(iHigh > grid.iColumnCount - 2)
+		iHigh = grid.iColumnCount - 2;
+	if(iHigh < iLow)
+		return 0;
+
+	iLow -= w * LIFE_WORD_BITS;
+	iHigh -= w * LIFE_WORD_BITS;
+	return (~(LifeWord) 0 >> (LIFE_WORD_BITS - 1 - iHigh)) & (~(LifeWord) 0 << iLow);
+}
+
+// Compute the rows [iRowStart, iRowEnd) of the next generation into gridNew
+void nextGeneration(const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd)
+{
+	nextGenerationWords(grid, gridNew, iRowStart, iRowEnd, 0, grid.iWordCount);
+}
+
+// Compute the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) of the next generation into gridNew
+void nextGenerationWords(const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	// The Larger than Life rules count the cells of a whole neighbourhood
+	const LifeRule &rule = getKernelRule();
+	if(isLargerThanLife(rule))
+	{
+		nextGenerationRadius(rule, grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+		return;
+	}
+
+	int iLastWord = grid.iWordCount - 1;
+
+	// Only the cells between the left and right layer are computed
+	LifeWord uFirstMask = interiorMask(grid, 0);
+	LifeWord uLastMask = interiorMask(grid, iLastWord);
+
+	// Widest kernel of the processor
+	LifeRowKernel nextRow = getRowKernel();
+
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		LifeWord *uRowNew = getRow(gridNew, i);
+
+		// The padding words left and right of the row are dead
+		nextRow(getRow(grid, i - 1) + iWordStart, getRow(grid, i) + iWordStart, getRow(grid, i + 1) + iWordStart,
+				uRowNew + iWordStart, iWordEnd - iWordStart);
+
+		if(iWordStart == 0)
+			uRowNew[0] &= uFirstMask;
+		if(iWordEnd > iLastWord)
+			uRowNew[iLastWord] &= uLastMask;
+	}
+}
+
+// Levels 2 .. iLevels of the rows [iBandStart, iBandEnd), level 1 being computed already. The level t lies in
+// grids[t % 2]. Every level loses a row on both sides (a trapezoid), and the levels are computed as a wavefront:
+// a row goes through all levels while the rows around it are still in cache.
+void nextGenerationsTrapezoid(LifeGrid *grids[2], int iBandStart, int iBandEnd, int iLevels)
+{
+	for(int p = iBandStart + 1; p < iBandEnd - 1; p++)
+	{
+		// The level t trails the level (t - 1) by a row, the rows it reads are complete by then
+		for(int t = 2; t <= iLevels; t++)
+		{
+			int j = p - (t - 2);
+			if(j >= iBandStart + t - 1 && j < iBandEnd - t + 1)
+				nextGeneration(*grids[(t - 1) % 2], *grids[t % 2], j, j + 1);
+		}
+	}
+}
+
+// Levels 2 .. iLevels of the rows around the border iBoundary of two trapezoids, left out by both of them
+void nextGenerationsTriangle(LifeGrid *grids[2], int iBoundary, int iLevels)
+{
+	for(int t = 2; t <= iLevels; t++)
+		nextGeneration(*grids[(t - 1) % 2], *grids[t % 2], iBoundary - t + 1, iBoundary + t - 1);
+}
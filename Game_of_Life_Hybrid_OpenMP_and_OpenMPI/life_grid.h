@@ -0,0 +1,84 @@
+/*
+ * The bit-packed grid of the Game of Life.
+ *
+ * Every cell is stored as one bit, 64 cells per word. The outer layers of the
+ * former int grids are kept as they were: row 0 and row (iRowCount - 1) are the
+ * top and bottom layers, bit 0 and bit (iColumnCount - 1) of every row are the
+ * left and right layers.
+ *
+ * All rows live in one cache-line aligned allocation. Every row is padded to a
+ * whole number of cache lines and keeps at least one dead word behind its cells,
+ * and a dead cache line sits in front of the first row, so the words left and
+ * right of any row are always readable.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.4 10/17/2026
+ *
+ */
+
+#if !defined LIFE_GRID_H
+#define LIFE_GRID_H
+
+// Including libraries
+#include <stdint.h>
+#include <stddef.h>
+
+// A packed word holds 64 cells of a row
+typedef uint64_t LifeWord;
+#define LIFE_WORD_BITS 64
+
+// Words of a cache line (64 bytes)
+#define LIFE_LINE_WORDS 8
+
+// The grid: dimensions count the outer layers as well
+struct LifeGrid
+{
+	int iRowCount;		// Number of rows (with the top and bottom layer)
+	int iColumnCount;	// Number of columns (with the left and right layer)
+	int iWordCount;		// Number of words needed to hold one row
+	int iStride;		// Number of words from one row to the next
+	LifeWord *uCells;	// Packed rows (with the padding)
+};
+
+// Packed words of the row i
+inline LifeWord *getRow(const LifeGrid &grid, int i)
+{
+	return grid.uCells + LIFE_LINE_WORDS + (ptrdiff_t) i * grid.iStride;
+}
+
+// Status of the cell (i, j)
+inline int getCell(const LifeGrid &grid, int i, int j)
+{
+	return (int) ((getRow(grid, i)[j / LIFE_WORD_BITS] >> (j % LIFE_WORD_BITS)) & 1);
+}
+
+// Set the status of the cell (i, j)
+inline void setCell(LifeGrid &grid, int i, int j, int iValue)
+{
+	LifeWord uBit = (LifeWord) 1 << (j % LIFE_WORD_BITS);
+
+	if(iValue)
+		getRow(grid, i)[j / LIFE_WORD_BITS] |= uBit;
+	else
+		getRow(grid, i)[j / LIFE_WORD_BITS] &= ~uBit;
+}
+
+// Signature of the methods
+void allocateGridUntouched(LifeGrid &grid, int iRowSize, int iColumnSize);
+void allocateGrid(LifeGrid &grid, int iRowSize, int iColumnSize);
+void freeGrid(LifeGrid &grid);
+void copyGrid(LifeGrid &gridTo, const LifeGrid &gridFrom);
+void swapGrids(LifeGrid &grid, LifeGrid &gridNew);
+void addOuterLayers(LifeGrid &grid);
+void addDeepOuterLayers(LifeGrid &grid, int iDepth);
+void addOuterColumns(LifeGrid &grid, int iRowStart, int iRowEnd);
+void copyBits(LifeWord *uTo, int iToBit, const LifeWord *uFrom, int iFromBit, int iBitCount);
+void clearBits(LifeWord *uRow, int iBit, int iBitCount);
+void setBits(LifeWord *uRow, int iBit, int iBitCount);
+void copyBlock(LifeGrid &gridTo, int iToRow, int iToColumn, const LifeGrid &gridFrom, int iFromRow, int iFromColumn, int iRowSize, int iColumnSize);
+void nextGeneration(const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd);
+void nextGenerationWords(const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd);
+void nextGenerationsTrapezoid(LifeGrid *grids[2], int iBandStart, int iBandEnd, int iLevels);
+void nextGenerationsTriangle(LifeGrid *grids[2], int iBoundary, int iLevels);
+
+#endif
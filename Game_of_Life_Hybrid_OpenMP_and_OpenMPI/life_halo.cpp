@@ -0,0 +1,203 @@
+/*
+ * The halo exchange of the Game of Life between neighbouring processes.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 3.1 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the halo exchange
+#include "life_halo.h"
+
+// Datatype of one packed row (the padding behind the row is not sent)
+MPI_Datatype createRowType(const LifeGrid &grid)
+{
+	MPI_Datatype rowType;
+	MPI_Type_contiguous(grid.iWordCount, MPI_UINT64_T, &rowType);
+	MPI_Type_commit(&rowType);
+	return rowType;
+}
+
+// Words holding the bits [iBit, iBit + iBitCount) of a row
+static int wordsOf(int iBit, int iBitCount)
+{
+	return (iBit + iBitCount - 1) / LIFE_WORD_BITS - iBit / LIFE_WORD_BITS + 1;
+}
+
+// Datatype of iWordCount packed words of each of iRowSize rows
+static MPI_Datatype createWordsType(const LifeGrid &grid, int iRowSize, int iWordCount)
+{
+	MPI_Datatype wordsType;
+	MPI_Type_vector(iRowSize, iWordCount, grid.iStride, MPI_UINT64_T, &wordsType);
+	MPI_Type_commit(&wordsType);
+	return wordsType;
+}
+
+// Cells of iRowSize rows, starting at bit iFromBit of the sender, arriving for the grid at (iToRow, iToColumn)
+static void createPart(LifeHaloPart &part, int iRowSize, int iFromBit, int iDepth, int iToRow, int iToColumn)
+{
+	part.iRowSize = iRowSize;
+	part.iWordCount = wordsOf(iFromBit, iDepth);
+	part.iBit = iFromBit % LIFE_WORD_BITS;
+	part.iToRow = iToRow;
+	part.iToColumn = iToColumn;
+
+	// One more word for copyBits to read behind the last row
+	part.uBuffer = (LifeWord *) calloc((size_t) iRowSize * part.iWordCount + 1, sizeof(LifeWord));
+}
+
+// Persistent requests exchanging the edges of one grid storage, none to or from a missing neighbour.
+// A message is tagged with the direction it travels to.
+static void createRequests(LifeHalo &halo, LifeGrid &grid, const LifeDomain &domain, MPI_Request *requests)
+{
+	int iRequest = 0;
+	int k = domain.iDepth, r = domain.iRowCount, c = domain.iColumnCount;
+	const int *iNeighbors = domain.iNeighbors;
+	MPI_Comm communicator = domain.cartComm;
+
+	// Where the rows and columns sent to each neighbour start: the first or the last k of the block
+	int iSendRows[LIFE_DIRECTIONS] = { k, r, k, k, k, k, r, r };
+	int iSendBits[LIFE_DIRECTIONS] = { 0, 0, k, c, k, c, k, c };
+
+	// The neighbour sending to a direction, and the part its cells arrive in
+	const int iFrom[LIFE_DIRECTIONS] =
+	{
+		LIFE_SOUTH, LIFE_NORTH, LIFE_EAST, LIFE_WEST,
+		LIFE_SOUTH_EAST, LIFE_SOUTH_WEST, LIFE_NORTH_EAST, LIFE_NORTH_WEST
+	};
+
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+	{
+		LifeWord *uSend = getRow(grid, iSendRows[d]) + iSendBits[d] / LIFE_WORD_BITS;
+		if(iNeighbors[d] != MPI_PROC_NULL)
+			MPI_Send_init(uSend, 1, halo.sendTypes[d], iNeighbors[d], d, communicator, &requests[iRequest++]);
+
+		if(iNeighbors[iFrom[d]] == MPI_PROC_NULL)
+			continue;
+
+		if(d == LIFE_NORTH || d == LIFE_SOUTH)
+		{
+			// Rows going up land in the bottom halo, rows going down in the top halo
+			LifeWord *uReceive = getRow(grid, (d == LIFE_NORTH) ? r + k : 0);
+			MPI_Recv_init(uReceive, 1, halo.rowType, iNeighbors[iFrom[d]], d, communicator, &requests[iRequest++]);
+		}
+		else
+		{
+			const LifeHaloPart &part = halo.parts[iFrom[d]];
+			MPI_Recv_init(part.uBuffer, part.iRowSize * part.iWordCount, MPI_UINT64_T, iNeighbors[iFrom[d]], d, communicator, &requests[iRequest++]);
+		}
+	}
+	halo.iRequestCount = iRequest;
+}
+
+// Set up the persistent requests of both grids (the grids hold the block with its halos)
+void createHalo(LifeHalo &halo, LifeGrid &grid, LifeGrid &gridNew, const LifeDomain &domain)
+{
+	int k = domain.iDepth, r = domain.iRowCount, c = domain.iColumnCount;
+	int w = domain.iWestColumnCount;
+
+	halo.iDepth = k;
+	halo.iActive = 0;
+
+	// k whole rows up and down, k columns (or k * k corner cells) to the sides
+	MPI_Type_vector(k, grid.iWordCount, grid.iStride, MPI_UINT64_T, &halo.rowType);
+	MPI_Type_commit(&halo.rowType);
+	halo.sendTypes[LIFE_NORTH] = halo.sendTypes[LIFE_SOUTH] = halo.rowType;
+	halo.sendTypes[LIFE_WEST] = createWordsType(grid, r, wordsOf(k, k));
+	halo.sendTypes[LIFE_EAST] = createWordsType(grid, r, wordsOf(c, k));
+	halo.sendTypes[LIFE_NORTH_WEST] = halo.sendTypes[LIFE_SOUTH_WEST] = createWordsType(grid, k, wordsOf(k, k));
+	halo.sendTypes[LIFE_NORTH_EAST] = halo.sendTypes[LIFE_SOUTH_EAST] = createWordsType(grid, k, wordsOf(c, k));
+
+	// The blocks on the left send their last k columns, the blocks on the right their first k columns.
+	// The rows from above and below arrive in the grid itself: their parts only tell where the halo is.
+	halo.parts[LIFE_NORTH].uBuffer = halo.parts[LIFE_SOUTH].uBuffer = NULL;
+	halo.parts[LIFE_NORTH].iRowSize = halo.parts[LIFE_SOUTH].iRowSize = k;
+	halo.parts[LIFE_NORTH].iToRow = 0;
+	halo.parts[LIFE_SOUTH].iToRow = r + k;
+	halo.parts[LIFE_NORTH].iToColumn = halo.parts[LIFE_SOUTH].iToColumn = 0;
+	createPart(halo.parts[LIFE_WEST], r, w, k, k, 0);
+	createPart(halo.parts[LIFE_EAST], r, k, k, k, c + k);
+	createPart(halo.parts[LIFE_NORTH_WEST], k, w, k, 0, 0);
+	createPart(halo.parts[LIFE_NORTH_EAST], k, k, k, 0, c + k);
+	createPart(halo.parts[LIFE_SOUTH_WEST], k, w, k, r + k, 0);
+	createPart(halo.parts[LIFE_SOUTH_EAST], k, k, k, r + k, c + k);
+
+	// The halos on the sides without a neighbour stay dead
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+		halo.iMissing[d] = (domain.iNeighbors[d] == MPI_PROC_NULL);
+
+	halo.uCells[0] = grid.uCells;
+	createRequests(halo, grid, domain, halo.requests[0]);
+
+	halo.uCells[1] = gridNew.uCells;
+	createRequests(halo, gridNew, domain, halo.requests[1]);
+}
+
+// Start the exchange of the edges of the block
+void startHalo(LifeHalo &halo, const LifeGrid &grid)
+{
+	halo.iActive = (grid.uCells == halo.uCells[0]) ? 0 : 1;
+	MPI_Startall(halo.iRequestCount, halo.requests[halo.iActive]);
+}
+
+// Kill the cells of the halos on the sides without a neighbour (the edges of a grid which is no torus):
+// whatever a generation left there, the cells beyond the edge are dead
+void clearBoundaryHalos(const LifeHalo &halo, LifeGrid &grid)
+{
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+	{
+		if(!halo.iMissing[d])
+			continue;
+
+		const LifeHaloPart &part = halo.parts[d];
+		for(int i = 0; i < part.iRowSize; i++)
+		{
+			if(d == LIFE_NORTH || d == LIFE_SOUTH)
+				memset(getRow(grid, part.iToRow + i), 0, grid.iWordCount * sizeof(LifeWord));
+			else
+				clearBits(getRow(grid, part.iToRow + i), part.iToColumn, halo.iDepth);
+		}
+	}
+}
+
+// Wait until the halos have arrived and complete the halos of the grid
+void finishHalo(LifeHalo &halo, LifeGrid &grid)
+{
+	MPI_Waitall(halo.iRequestCount, halo.requests[halo.iActive], MPI_STATUSES_IGNORE);
+
+	// The rows from above and below came with their own halo columns: the columns and corners are laid over them
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+	{
+		const LifeHaloPart &part = halo.parts[d];
+		if(!part.uBuffer || halo.iMissing[d])
+			continue;
+
+		for(int i = 0; i < part.iRowSize; i++)
+			copyBits(getRow(grid, part.iToRow + i), part.iToColumn, part.uBuffer + (size_t) i * part.iWordCount, part.iBit, halo.iDepth);
+	}
+
+	// No neighbour, no cells
+	clearBoundaryHalos(halo, grid);
+}
+
+// Release the persistent requests, the buffers and the datatypes
+void freeHalo(LifeHalo &halo)
+{
+	for(int k = 0; k < 2; k++)
+		for(int i = 0; i < halo.iRequestCount; i++)
+			MPI_Request_free(&halo.requests[k][i]);
+
+	for(int d = 0; d < LIFE_DIRECTIONS; d++)
+	{
+		free(halo.parts[d].uBuffer);
+
+		// Rows and corners share their datatypes
+		if(d != LIFE_NORTH && d != LIFE_SOUTH && d != LIFE_SOUTH_WEST && d != LIFE_SOUTH_EAST)
+			MPI_Type_free(&halo.sendTypes[d]);
+	}
+	MPI_Type_free(&halo.rowType);
+}
@@ -0,0 +1,77 @@
+/*
+ * The halo exchange of the Game of Life between neighbouring processes.
+ *
+ * Every process owns a 2D block of the grid and exchanges its edges with the
+ * eight neighbouring blocks: iDepth rows with the blocks above and below,
+ * iDepth columns with the blocks on the left and right and iDepth * iDepth
+ * cells with the diagonal blocks. With halos of iDepth rows and columns a
+ * process advances iDepth generations between two exchanges.
+ *
+ * The messages get their persistent requests (MPI_Send_init / MPI_Recv_init)
+ * once, every generation only starts and completes them. Processes synchronize
+ * through these messages alone.
+ *
+ * Rows are sent straight out of the grid and received straight into its top
+ * and bottom halo. Columns and corners are sent straight out of the grid as
+ * well (an MPI_Type_vector picks the packed words holding them from every row);
+ * they arrive in small buffers, and their bits are unpacked into the left and
+ * right halo once the exchange completes. As the grid and the new grid swap
+ * their storage every generation, there is a set of requests for each of the
+ * two storages.
+ *
+ * A block at the edge of a grid which is no torus has no neighbour on that
+ * side: it neither sends nor receives anything there, its halo on that side is
+ * kept dead instead.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 3.1 10/17/2026
+ *
+ */
+
+#if !defined LIFE_HALO_H
+#define LIFE_HALO_H
+
+// Including libraries
+#include <mpi.h>
+
+// Including the bit-packed grid and its decomposition
+#include "life_grid.h"
+#include "life_domain.h"
+
+// Messages of the exchange: a send and a receive for each direction
+#define LIFE_HALO_REQUESTS (2 * LIFE_DIRECTIONS)
+
+// Cells arriving from one neighbour into a buffer, and where they belong in the grid
+struct LifeHaloPart
+{
+	LifeWord *uBuffer;		// iRowSize rows of iWordCount words
+	int iRowSize;
+	int iWordCount;
+	int iBit;				// First bit of the cells in the words of a row
+	int iToRow;				// Position of the cells in the grid
+	int iToColumn;
+};
+
+// Halo exchange of a block with its eight neighbours
+struct LifeHalo
+{
+	MPI_Datatype rowType;								// The rows of a halo
+	MPI_Datatype sendTypes[LIFE_DIRECTIONS];			// Packed words sent to each neighbour
+	LifeWord *uCells[2];								// Storage of the grid and of the new grid
+	MPI_Request requests[2][LIFE_HALO_REQUESTS];		// Persistent requests for each storage
+	int iRequestCount;									// Requests of a storage (none to or from a missing neighbour)
+	LifeHaloPart parts[LIFE_DIRECTIONS];				// Halos of the neighbours (the buffers of the columns and corners)
+	int iMissing[LIFE_DIRECTIONS];						// No neighbour in this direction: the halo stays dead
+	int iDepth;											// Rows and columns of the halos
+	int iActive;										// Storage of the exchange in flight
+};
+
+// Signature of the methods
+MPI_Datatype createRowType(const LifeGrid &grid);
+void createHalo(LifeHalo &halo, LifeGrid &grid, LifeGrid &gridNew, const LifeDomain &domain);
+void startHalo(LifeHalo &halo, const LifeGrid &grid);
+void finishHalo(LifeHalo &halo, LifeGrid &grid);
+void clearBoundaryHalos(const LifeHalo &halo, LifeGrid &grid);
+void freeHalo(LifeHalo &halo);
+
+#endif
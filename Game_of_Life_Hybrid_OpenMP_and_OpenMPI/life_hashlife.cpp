@@ -0,0 +1,972 @@
+/*
+ * The HashLife engine of the Game of Life.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+
+// Including the HashLife engine and the kernel of the bit-packed grid
+#include "life_hashlife.h"
+#include "life_kernel.h"
+
+using namespace std;
+
+// Set up an empty table, the nodes may take up to iMemoryBytes
+void createHashLife(LifeHashLife &life, size_t iMemoryBytes)
+{
+	life.iBucketCount = 1 << 16;
+	life.buckets = (LifeNode **) calloc(life.iBucketCount, sizeof(LifeNode *));
+	life.iNodeCount = 0;
+	life.iMaxNodes = iMemoryBytes / (sizeof(LifeNode) + sizeof(LifeNode *));
+	life.freeNodes = NULL;
+	life.blocks = NULL;
+	life.iBlockCount = 0;
+	life.root = life.window = NULL;
+	life.lRowOrigin = life.lColumnOrigin = 0;
+	life.lCollections = 0;
+	memset(life.empty, 0, sizeof(life.empty));
+}
+
+// Free all nodes and the table
+void freeHashLife(LifeHashLife &life)
+{
+	for(size_t i = 0; i < life.iBlockCount; i++)
+		free(life.blocks[i]);
+	free(life.blocks);
+	free(life.buckets);
+	life.blocks = NULL;
+	life.buckets = NULL;
+}
+
+// Mix all bits of a word into all bits of the hash
+static size_t mixBits(uint64_t h)
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ull;
+	h ^= h >> 33;
+	return (size_t) h;
+}
+
+// Hash of a leaf
+static size_t hashLeaf(uint64_t uCells)
+{
+	return mixBits(uCells);
+}
+
+// Hash of a node by the addresses of its quadrants
+static size_t hashNode(const LifeNode *nw, const LifeNode *ne, const LifeNode *sw, const LifeNode *se)
+{
+	uint64_t h = (uintptr_t) nw;
+	h = h * 0x9e3779b97f4a7c15ull + (uintptr_t) ne;
+	h = h * 0x9e3779b97f4a7c15ull + (uintptr_t) sw;
+	h = h * 0x9e3779b97f4a7c15ull + (uintptr_t) se;
+	return mixBits(h);
+}
+
+// Hash of any node
+static size_t hashOf(const LifeNode *node)
+{
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+		return hashLeaf(node->uCells);
+	return hashNode(node->nw, node->ne, node->sw, node->se);
+}
+
+// Twice the buckets once there are more nodes than buckets
+static void growTable(LifeHashLife &life)
+{
+	size_t iBucketCount = life.iBucketCount * 2;
+	LifeNode **buckets = (LifeNode **) calloc(iBucketCount, sizeof(LifeNode *));
+	if(!buckets)
+		return;
+
+	for(size_t i = 0; i < life.iBucketCount; i++)
+	{
+		LifeNode *node = life.buckets[i];
+		while(node)
+		{
+			LifeNode *next = node->next;
+			size_t iBucket = hashOf(node) & (iBucketCount - 1);
+			node->next = buckets[iBucket];
+			buckets[iBucket] = node;
+			node = next;
+		}
+	}
+
+	free(life.buckets);
+	life.buckets = buckets;
+	life.iBucketCount = iBucketCount;
+}
+
+// A new node in the bucket iBucket, a block of nodes is allocated when none is free
+static LifeNode *newNode(LifeHashLife &life, size_t iBucket, int iLevel)
+{
+	if(!life.freeNodes)
+	{
+		LifeNode *block = (LifeNode *) malloc(LIFE_NODE_BLOCK * sizeof(LifeNode));
+		life.blocks = (void **) realloc(life.blocks, (life.iBlockCount + 1) * sizeof(void *));
+		if(!block || !life.blocks)
+		{
+			cerr << "Unable to allocate the nodes of HashLife" << endl;
+			abort();
+		}
+		life.blocks[life.iBlockCount++] = block;
+
+		for(int i = 0; i < LIFE_NODE_BLOCK; i++)
+		{
+			block[i].next = life.freeNodes;
+			life.freeNodes = &block[i];
+		}
+	}
+
+	LifeNode *node = life.freeNodes;
+	life.freeNodes = node->next;
+
+	node->nw = node->ne = node->sw = node->se = NULL;
+	node->uCells = 0;
+	node->result = node->stepResult = NULL;
+	node->iLevel = iLevel;
+	node->iStep = -1;
+	node->iMark = 0;
+	node->next = life.buckets[iBucket];
+	life.buckets[iBucket] = node;
+	life.iNodeCount++;
+	return node;
+}
+
+// The leaf of the given cells
+LifeNode *findLeaf(LifeHashLife &life, uint64_t uCells)
+{
+	size_t iBucket = hashLeaf(uCells) & (life.iBucketCount - 1);
+	for(LifeNode *node = life.buckets[iBucket]; node; node = node->next)
+		if(node->iLevel == LIFE_LEAF_LEVEL && node->uCells == uCells)
+			return node;
+
+	if(life.iNodeCount > life.iBucketCount)
+	{
+		growTable(life);
+		iBucket = hashLeaf(uCells) & (life.iBucketCount - 1);
+	}
+
+	LifeNode *node = newNode(life, iBucket, LIFE_LEAF_LEVEL);
+	node->uCells = uCells;
+	return node;
+}
+
+// The node of the given quadrants
+LifeNode *findNode(LifeHashLife &life, LifeNode *nw, LifeNode *ne, LifeNode *sw, LifeNode *se)
+{
+	size_t iBucket = hashNode(nw, ne, sw, se) & (life.iBucketCount - 1);
+	for(LifeNode *node = life.buckets[iBucket]; node; node = node->next)
+		if(node->nw == nw && node->ne == ne && node->sw == sw && node->se == se && node->iLevel > LIFE_LEAF_LEVEL)
+			return node;
+
+	if(life.iNodeCount > life.iBucketCount)
+	{
+		growTable(life);
+		iBucket = hashNode(nw, ne, sw, se) & (life.iBucketCount - 1);
+	}
+
+	LifeNode *node = newNode(life, iBucket, nw->iLevel + 1);
+	node->nw = nw;
+	node->ne = ne;
+	node->sw = sw;
+	node->se = se;
+	return node;
+}
+
+// The node of the level without any live cell
+LifeNode *emptyNode(LifeHashLife &life, int iLevel)
+{
+	if(iLevel >= LIFE_MAX_LEVEL)
+	{
+		LifeNode *empty = emptyNode(life, iLevel - 1);
+		return findNode(life, empty, empty, empty, empty);
+	}
+
+	if(!life.empty[iLevel])
+	{
+		if(iLevel == LIFE_LEAF_LEVEL)
+			life.empty[iLevel] = findLeaf(life, 0);
+		else
+		{
+			LifeNode *empty = emptyNode(life, iLevel - 1);
+			life.empty[iLevel] = findNode(life, empty, empty, empty, empty);
+		}
+	}
+	return life.empty[iLevel];
+}
+
+// Center leaf of a node of level 4 (16 * 16 cells) iGenerations (up to 4) generations later
+static LifeNode *advanceLeaves(LifeHashLife &life, const LifeNode *node, int iGenerations)
+{
+	// Rows of 16 cells, the left quadrant in the lower byte
+	LifeWord uRows[16], uRowsNew[16];
+	for(int r = 0; r < 8; r++)
+	{
+		uRows[r] = ((node->nw->uCells >> (8 * r)) & 0xff) | (((node->ne->uCells >> (8 * r)) & 0xff) << 8);
+		uRows[r + 8] = ((node->sw->uCells >> (8 * r)) & 0xff) | (((node->se->uCells >> (8 * r)) & 0xff) << 8);
+	}
+
+	// The cells outside are dead, after g generations the cells up to g rows or columns away from the edge are wrong
+	const LifeWord uNone = 0;
+	LifeWordKernel nextWordKernel = getWordKernel();
+	for(int g = 0; g < iGenerations; g++)
+	{
+		for(int r = 0; r < 16; r++)
+		{
+			const LifeWord &uAbove = (r > 0) ? uRows[r - 1] : uNone;
+			const LifeWord &uBelow = (r < 15) ? uRows[r + 1] : uNone;
+			uRowsNew[r] = nextWordKernel(uNone, uAbove, uNone, uNone, uRows[r], uNone, uNone, uBelow, uNone) & 0xffff;
+		}
+		memcpy(uRows, uRowsNew, sizeof(uRows));
+	}
+
+	// The 8 * 8 cells of the center
+	uint64_t uCells = 0;
+	for(int r = 0; r < 8; r++)
+		uCells |= ((uRows[r + 4] >> 4) & 0xff) << (8 * r);
+	return findLeaf(life, uCells);
+}
+
+// Center of a node (half its size), no generation later
+static LifeNode *centerNode(LifeHashLife &life, LifeNode *node)
+{
+	if(node->iLevel == LIFE_LEAF_LEVEL + 1)
+		return advanceLeaves(life, node, 0);
+	return findNode(life, node->nw->se, node->ne->sw, node->sw->ne, node->se->nw);
+}
+
+// Center of a node of level n (at least 4) 2^iStep generations later, iStep up to (n - 2)
+LifeNode *advanceNode(LifeHashLife &life, LifeNode *node, int iStep)
+{
+	int n = node->iLevel;
+	if(iStep == n - 2 && node->result)
+		return node->result;
+	if(iStep < n - 2 && node->iStep == iStep)
+		return node->stepResult;
+
+	LifeNode *result;
+	if(n == LIFE_LEAF_LEVEL + 1)
+		result = advanceLeaves(life, node, 1 << iStep);
+	else
+	{
+		// Nine overlapping nodes of level (n - 1)
+		LifeNode *t00 = node->nw, *t02 = node->ne, *t20 = node->sw, *t22 = node->se;
+		LifeNode *t01 = findNode(life, node->nw->ne, node->ne->nw, node->nw->se, node->ne->sw);
+		LifeNode *t10 = findNode(life, node->nw->sw, node->nw->se, node->sw->nw, node->sw->ne);
+		LifeNode *t11 = findNode(life, node->nw->se, node->ne->sw, node->sw->ne, node->se->nw);
+		LifeNode *t12 = findNode(life, node->ne->sw, node->ne->se, node->se->nw, node->se->ne);
+		LifeNode *t21 = findNode(life, node->sw->ne, node->se->nw, node->sw->se, node->se->sw);
+
+		// Their centers half of the generations later (or all of them for a smaller step)
+		int iInnerStep = (iStep == n - 2) ? n - 3 : iStep;
+		LifeNode *r00 = advanceNode(life, t00, iInnerStep), *r01 = advanceNode(life, t01, iInnerStep), *r02 = advanceNode(life, t02, iInnerStep);
+		LifeNode *r10 = advanceNode(life, t10, iInnerStep), *r11 = advanceNode(life, t11, iInnerStep), *r12 = advanceNode(life, t12, iInnerStep);
+		LifeNode *r20 = advanceNode(life, t20, iInnerStep), *r21 = advanceNode(life, t21, iInnerStep), *r22 = advanceNode(life, t22, iInnerStep);
+
+		// Four overlapping nodes of them, their centers the other half of the generations later (or right away)
+		LifeNode *c[4] = { findNode(life, r00, r01, r10, r11), findNode(life, r01, r02, r11, r12),
+						   findNode(life, r10, r11, r20, r21), findNode(life, r11, r12, r21, r22) };
+		for(int k = 0; k < 4; k++)
+			c[k] = (iStep == n - 2) ? advanceNode(life, c[k], n - 3) : centerNode(life, c[k]);
+
+		result = findNode(life, c[0], c[1], c[2], c[3]);
+	}
+
+	if(iStep == n - 2)
+		node->result = result;
+	else
+	{
+		node->stepResult = result;
+		node->iStep = iStep;
+	}
+	return result;
+}
+
+// Mark the node, its quadrants and (with iResults) its results
+static void markNode(LifeNode *node, int iResults)
+{
+	if(!node || node->iMark)
+		return;
+
+	node->iMark = 1;
+	if(node->iLevel > LIFE_LEAF_LEVEL)
+	{
+		markNode(node->nw, iResults);
+		markNode(node->ne, iResults);
+		markNode(node->sw, iResults);
+		markNode(node->se, iResults);
+	}
+	if(iResults)
+	{
+		markNode(node->result, iResults);
+		markNode(node->stepResult, iResults);
+	}
+}
+
+// Free the nodes which are not marked, the marks of the others are cleared
+static void sweepNodes(LifeHashLife &life)
+{
+	for(size_t i = 0; i < life.iBucketCount; i++)
+	{
+		LifeNode **link = &life.buckets[i];
+		while(*link)
+		{
+			LifeNode *node = *link;
+			if(node->iMark)
+			{
+				node->iMark = 0;
+				link = &node->next;
+			}
+			else
+			{
+				*link = node->next;
+				node->next = life.freeNodes;
+				life.freeNodes = node;
+				life.iNodeCount--;
+			}
+		}
+	}
+}
+
+// Free the nodes which are not needed for the current pattern: the results stay as long as half the memory is left
+void collectGarbage(LifeHashLife &life)
+{
+	life.lCollections++;
+
+	markNode(life.root, 1);
+	markNode(life.window, 1);
+	for(int l = 0; l < LIFE_MAX_LEVEL; l++)
+		markNode(life.empty[l], 1);
+	sweepNodes(life);
+
+	if(life.iNodeCount <= life.iMaxNodes / 2)
+		return;
+
+	// Not enough: all results are forgotten
+	for(size_t i = 0; i < life.iBucketCount; i++)
+	{
+		for(LifeNode *node = life.buckets[i]; node; node = node->next)
+		{
+			node->result = node->stepResult = NULL;
+			node->iStep = -1;
+		}
+	}
+
+	markNode(life.root, 0);
+	markNode(life.window, 0);
+	for(int l = 0; l < LIFE_MAX_LEVEL; l++)
+		markNode(life.empty[l], 0);
+	sweepNodes(life);
+}
+
+
+// An empty list of leaves
+void createLeaves(LifeLeaves &leaves)
+{
+	leaves.leaves = NULL;
+	leaves.lCount = leaves.lAllocated = 0;
+}
+
+// Add the cells of the leaf at the row lRow and the column lColumn of the leaves, the same leaf may be added again
+void addLeaf(LifeLeaves &leaves, long long lRow, long long lColumn, uint64_t uCells)
+{
+	if(leaves.lCount == leaves.lAllocated)
+	{
+		leaves.lAllocated = leaves.lAllocated ? 2 * leaves.lAllocated : 1024;
+		leaves.leaves = (LifeLeaf *) realloc(leaves.leaves, leaves.lAllocated * sizeof(LifeLeaf));
+		if(!leaves.leaves)
+		{
+			cerr << "Unable to allocate the leaves of HashLife" << endl;
+			abort();
+		}
+	}
+
+	LifeLeaf &leaf = leaves.leaves[leaves.lCount++];
+	leaf.lRow = lRow;
+	leaf.lColumn = lColumn;
+	leaf.uCells = uCells;
+}
+
+// Add the leaves of a band of eight rows at the row lRow of the leaves, leaf k of the band at the column k; the band is cleared
+void addBand(LifeLeaves &leaves, long long lRow, uint64_t *uBand, long long lLeafCount)
+{
+	for(long long k = 0; k < lLeafCount; k++)
+	{
+		if(uBand[k])
+		{
+			addLeaf(leaves, lRow, k, uBand[k]);
+			uBand[k] = 0;
+		}
+	}
+}
+
+// Add a run of lCount live cells from the cell (lRow, lColumn) on
+void addRun(LifeLeaves &leaves, long long lRow, long long lColumn, long long lCount)
+{
+	int iShift = 8 * (int) (lRow % 8);
+	while(lCount > 0)
+	{
+		int iFirst = (int) (lColumn % 8);
+		int iCells = (lCount < 8 - iFirst) ? (int) lCount : 8 - iFirst;
+		uint64_t uCells = ((((uint64_t) 1 << iCells) - 1) << iFirst) << iShift;
+
+		// The runs of a row often end in the leaf of the run before
+		LifeLeaf *last = leaves.lCount ? &leaves.leaves[leaves.lCount - 1] : NULL;
+		if(last && last->lRow == lRow / 8 && last->lColumn == lColumn / 8)
+			last->uCells |= uCells;
+		else
+			addLeaf(leaves, lRow / 8, lColumn / 8, uCells);
+
+		lColumn += iCells;
+		lCount -= iCells;
+	}
+}
+
+// Level of the smallest node (at least a leaf) of lRowCount * lColumnCount cells
+int patternLevel(long long lRowCount, long long lColumnCount)
+{
+	int iLevel = LIFE_LEAF_LEVEL;
+	while((1ll << iLevel) < lRowCount || (1ll << iLevel) < lColumnCount)
+		iLevel++;
+	return iLevel;
+}
+
+// Order of the leaves along the quadrants: the highest bit in which the rows or the columns differ decides, the rows
+// before the columns
+static int compareLeaves(const void *pFirst, const void *pSecond)
+{
+	const LifeLeaf *first = (const LifeLeaf *) pFirst, *second = (const LifeLeaf *) pSecond;
+	uint64_t uRows = (uint64_t) (first->lRow ^ second->lRow), uColumns = (uint64_t) (first->lColumn ^ second->lColumn);
+	if(uRows < uColumns && uRows < (uRows ^ uColumns))
+		return (first->lColumn < second->lColumn) ? -1 : 1;
+	if(uRows)
+		return (first->lRow < second->lRow) ? -1 : 1;
+	return 0;
+}
+
+// Whether the leaf lies within the lSide * lSide leaves from the leaf (lRow, lColumn)
+static int isLeafWithin(const LifeLeaf &leaf, long long lRow, long long lColumn, long long lSide)
+{
+	return leaf.lRow >= lRow && leaf.lRow < lRow + lSide && leaf.lColumn >= lColumn && leaf.lColumn < lColumn + lSide;
+}
+
+// Node of level iLevel from the leaf (lRow, lColumn) on, of the leaves [lFirst, lEnd) sorted along the quadrants
+static LifeNode *buildNode(LifeHashLife &life, const LifeLeaf *leaves, long lFirst, long lEnd, int iLevel, long long lRow, long long lColumn)
+{
+	if(lFirst == lEnd)
+		return emptyNode(life, iLevel);
+	if(iLevel == LIFE_LEAF_LEVEL)
+		return findLeaf(life, leaves[lFirst].uCells);
+
+	// The leaves of every quadrant follow each other
+	long long lHalf = 1ll << (iLevel - 1 - LIFE_LEAF_LEVEL);
+	LifeNode *quadrants[4];
+	long lLeaf = lFirst;
+	for(int q = 0; q < 4; q++)
+	{
+		long long lQuadrantRow = lRow + (q / 2) * lHalf, lQuadrantColumn = lColumn + (q % 2) * lHalf;
+		long lStart = lLeaf;
+		while(lLeaf < lEnd && isLeafWithin(leaves[lLeaf], lQuadrantRow, lQuadrantColumn, lHalf))
+			lLeaf++;
+		quadrants[q] = buildNode(life, leaves, lStart, lLeaf, iLevel - 1, lQuadrantRow, lQuadrantColumn);
+	}
+	return findNode(life, quadrants[0], quadrants[1], quadrants[2], quadrants[3]);
+}
+
+// The node of level iLevel of the leaves, those beyond it are left out. The leaves are freed.
+LifeNode *buildPattern(LifeHashLife &life, LifeLeaves &leaves, int iLevel)
+{
+	qsort(leaves.leaves, leaves.lCount, sizeof(LifeLeaf), compareLeaves);
+
+	// A leaf added several times holds the cells of all of them
+	long long lSide = 1ll << (iLevel - LIFE_LEAF_LEVEL);
+	long lCount = 0;
+	for(long k = 0; k < leaves.lCount; k++)
+	{
+		const LifeLeaf &leaf = leaves.leaves[k];
+		if(!isLeafWithin(leaf, 0, 0, lSide))
+			continue;
+
+		LifeLeaf *last = lCount ? &leaves.leaves[lCount - 1] : NULL;
+		if(last && last->lRow == leaf.lRow && last->lColumn == leaf.lColumn)
+			last->uCells |= leaf.uCells;
+		else
+			leaves.leaves[lCount++] = leaf;
+	}
+
+	LifeNode *node = buildNode(life, leaves.leaves, 0, lCount, iLevel, 0, 0);
+	free(leaves.leaves);
+	createLeaves(leaves);
+	return node;
+}
+
+// Whether the node has no live cell
+static int isEmpty(LifeHashLife &life, LifeNode *node)
+{
+	return node == emptyNode(life, node->iLevel);
+}
+
+// A row or column of the plane relative to a leaf, kept within the leaf (0 .. 8)
+static int clampToLeaf(long long lCell)
+{
+	return (lCell < 0) ? 0 : (lCell > 8) ? 8 : (int) lCell;
+}
+
+// Cells of a leaf within its rows [iRowStart, iRowEnd) and columns [iColumnStart, iColumnEnd)
+static uint64_t leafMask(int iRowStart, int iRowEnd, int iColumnStart, int iColumnEnd)
+{
+	uint64_t uRow = (iColumnEnd > iColumnStart) ? ((((uint64_t) 1 << (iColumnEnd - iColumnStart)) - 1) << iColumnStart) : 0;
+	uint64_t uMask = 0;
+	for(int r = iRowStart; r < iRowEnd; r++)
+		uMask |= uRow << (8 * r);
+	return uMask;
+}
+
+// The node of level iLevel of the node holding its cell (lRow, lColumn)
+static LifeNode *subNode(LifeNode *node, int iLevel, long long lRow, long long lColumn)
+{
+	while(node->iLevel > iLevel)
+	{
+		int iBit = node->iLevel - 1;
+		int iSouth = (int) ((lRow >> iBit) & 1), iEast = (int) ((lColumn >> iBit) & 1);
+		node = iSouth ? (iEast ? node->se : node->sw) : (iEast ? node->ne : node->nw);
+	}
+	return node;
+}
+
+// Whether the node at (lRow, lColumn) has a live cell within the rows [lRowStart, lRowEnd) and the columns
+// [lColumnStart, lColumnEnd)
+static int hasLiveCell(LifeHashLife &life, LifeNode *node, long long lRow, long long lColumn, long long lRowStart, long long lRowEnd,
+					   long long lColumnStart, long long lColumnEnd)
+{
+	long long lSide = 1ll << node->iLevel;
+	if(lRowStart >= lRow + lSide || lRowEnd <= lRow || lColumnStart >= lColumn + lSide || lColumnEnd <= lColumn || isEmpty(life, node))
+		return 0;
+	if(lRowStart <= lRow && lRowEnd >= lRow + lSide && lColumnStart <= lColumn && lColumnEnd >= lColumn + lSide)
+		return 1;
+
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+		return (node->uCells & leafMask(clampToLeaf(lRowStart - lRow), clampToLeaf(lRowEnd - lRow), clampToLeaf(lColumnStart - lColumn),
+										clampToLeaf(lColumnEnd - lColumn))) != 0;
+
+	long long lHalf = lSide / 2;
+	return hasLiveCell(life, node->nw, lRow, lColumn, lRowStart, lRowEnd, lColumnStart, lColumnEnd)
+		|| hasLiveCell(life, node->ne, lRow, lColumn + lHalf, lRowStart, lRowEnd, lColumnStart, lColumnEnd)
+		|| hasLiveCell(life, node->sw, lRow + lHalf, lColumn, lRowStart, lRowEnd, lColumnStart, lColumnEnd)
+		|| hasLiveCell(life, node->se, lRow + lHalf, lColumn + lHalf, lRowStart, lRowEnd, lColumnStart, lColumnEnd);
+}
+
+// The lSize rows (or columns) from lStart on, around a torus of lPeriod of them, as at most two intervals within it
+static int wrapInterval(long long lStart, long long lSize, long long lPeriod, long long lIntervals[2][2])
+{
+	if(lSize >= lPeriod)
+	{
+		lIntervals[0][0] = 0;
+		lIntervals[0][1] = lPeriod;
+		return 1;
+	}
+
+	lIntervals[0][0] = lStart;
+	lIntervals[0][1] = (lStart + lSize < lPeriod) ? lStart + lSize : lPeriod;
+	lIntervals[1][0] = 0;
+	lIntervals[1][1] = lStart + lSize - lPeriod;
+	return (lStart + lSize <= lPeriod) ? 1 : 2;
+}
+
+// Whether the torus of lRowCount * lColumnCount cells held by the pattern has a live cell within lSide rows from lRow on
+// and lSide columns from lColumn on, both wrapping around
+static int hasLiveTorus(LifeHashLife &life, LifeNode *pattern, long long lRow, long long lColumn, long long lSide, long long lRowCount,
+						long long lColumnCount)
+{
+	long long lRows[2][2], lColumns[2][2];
+	int iRowIntervals = wrapInterval(lRow, lSide, lRowCount, lRows);
+	int iColumnIntervals = wrapInterval(lColumn, lSide, lColumnCount, lColumns);
+	for(int i = 0; i < iRowIntervals; i++)
+		for(int j = 0; j < iColumnIntervals; j++)
+			if(hasLiveCell(life, pattern, 0, 0, lRows[i][0], lRows[i][1], lColumns[j][0], lColumns[j][1]))
+				return 1;
+	return 0;
+}
+
+// Eight cells of the row lRow of the torus of lColumnCount columns held by the pattern, from the column lColumn on
+static uint64_t torusByte(LifeNode *pattern, long long lRow, long long lColumn, long long lColumnCount)
+{
+	int iShift = 8 * (int) (lRow % 8);
+
+	// Two leaves at most, one cell at a time where the torus wraps around
+	if(lColumn + 8 <= lColumnCount)
+	{
+		int iFirst = (int) (lColumn % 8);
+		uint64_t uByte = ((subNode(pattern, LIFE_LEAF_LEVEL, lRow, lColumn)->uCells >> iShift) & 0xff) >> iFirst;
+		if(iFirst)
+			uByte |= ((subNode(pattern, LIFE_LEAF_LEVEL, lRow, lColumn + 7)->uCells >> iShift) & 0xff) << (8 - iFirst);
+		return uByte & 0xff;
+	}
+
+	uint64_t uByte = 0;
+	for(int c = 0; c < 8; c++)
+	{
+		long long j = (lColumn + c) % lColumnCount;
+		uByte |= ((subNode(pattern, LIFE_LEAF_LEVEL, lRow, j)->uCells >> (iShift + j % 8)) & 1) << c;
+	}
+	return uByte;
+}
+
+// Cells of the 8 * 8 cells of the torus of lRowCount * lColumnCount cells held by the pattern from the cell (lRow, lColumn) on
+static uint64_t torusLeaf(LifeNode *pattern, long long lRow, long long lColumn, long long lRowCount, long long lColumnCount)
+{
+	uint64_t uCells = 0;
+
+	// Away from the edges of the torus the cells lie in four leaves of the pattern at most
+	if(lRow + 8 <= lRowCount && lColumn + 8 <= lColumnCount)
+	{
+		int iFirstRow = (int) (lRow % 8), iFirstColumn = (int) (lColumn % 8);
+		uint64_t uLeaves[2][2];
+		uLeaves[0][0] = subNode(pattern, LIFE_LEAF_LEVEL, lRow, lColumn)->uCells;
+		uLeaves[0][1] = iFirstColumn ? subNode(pattern, LIFE_LEAF_LEVEL, lRow, lColumn + 7)->uCells : 0;
+		uLeaves[1][0] = iFirstRow ? subNode(pattern, LIFE_LEAF_LEVEL, lRow + 7, lColumn)->uCells : 0;
+		uLeaves[1][1] = (iFirstRow && iFirstColumn) ? subNode(pattern, LIFE_LEAF_LEVEL, lRow + 7, lColumn + 7)->uCells : 0;
+
+		for(int r = 0; r < 8; r++)
+		{
+			int iRow = iFirstRow + r, iShift = 8 * (iRow % 8);
+			const uint64_t *uRowLeaves = uLeaves[iRow / 8];
+			uint64_t uByte = ((uRowLeaves[0] >> iShift) & 0xff) >> iFirstColumn;
+			if(iFirstColumn)
+				uByte |= ((uRowLeaves[1] >> iShift) & 0xff) << (8 - iFirstColumn);
+			uCells |= (uByte & 0xff) << (8 * r);
+		}
+		return uCells;
+	}
+
+	for(int r = 0; r < 8; r++)
+		uCells |= torusByte(pattern, (lRow + r) % lRowCount, lColumn, lColumnCount) << (8 * r);
+	return uCells;
+}
+
+// Node of level iLevel whose cell (r, c) is the cell ((lRow + r) mod lRowCount, (lColumn + c) mod lColumnCount) of the torus
+// held by the pattern, lRow and lColumn lying on the torus. Dead areas are the empty nodes, and the nodes of the pattern
+// lying on the torus are taken as they are.
+static LifeNode *cutTorus(LifeHashLife &life, LifeNode *pattern, int iLevel, long long lRow, long long lColumn, long long lRowCount,
+						  long long lColumnCount)
+{
+	if(iLevel == LIFE_LEAF_LEVEL)
+		return findLeaf(life, torusLeaf(pattern, lRow, lColumn, lRowCount, lColumnCount));
+
+	long long lSide = 1ll << iLevel;
+	if(!hasLiveTorus(life, pattern, lRow, lColumn, lSide, lRowCount, lColumnCount))
+		return emptyNode(life, iLevel);
+	if(lRow % lSide == 0 && lColumn % lSide == 0 && lRow + lSide <= lRowCount && lColumn + lSide <= lColumnCount)
+		return subNode(pattern, iLevel, lRow, lColumn);
+
+	long long lHalf = lSide / 2, lRowHalf = (lRow + lHalf) % lRowCount, lColumnHalf = (lColumn + lHalf) % lColumnCount;
+	LifeNode *nw = cutTorus(life, pattern, iLevel - 1, lRow, lColumn, lRowCount, lColumnCount);
+	LifeNode *ne = cutTorus(life, pattern, iLevel - 1, lRow, lColumnHalf, lRowCount, lColumnCount);
+	LifeNode *sw = cutTorus(life, pattern, iLevel - 1, lRowHalf, lColumn, lRowCount, lColumnCount);
+	LifeNode *se = cutTorus(life, pattern, iLevel - 1, lRowHalf, lColumnHalf, lRowCount, lColumnCount);
+	return findNode(life, nw, ne, sw, se);
+}
+
+// The node at (lRow, lColumn) without its cells beyond the first lRowCount rows and lColumnCount columns
+static LifeNode *clipNode(LifeHashLife &life, LifeNode *node, long long lRow, long long lColumn, long long lRowCount, long long lColumnCount)
+{
+	long long lSide = 1ll << node->iLevel;
+	if((lRow + lSide <= lRowCount && lColumn + lSide <= lColumnCount) || isEmpty(life, node))
+		return node;
+	if(lRow >= lRowCount || lColumn >= lColumnCount)
+		return emptyNode(life, node->iLevel);
+
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+		return findLeaf(life, node->uCells & leafMask(0, clampToLeaf(lRowCount - lRow), 0, clampToLeaf(lColumnCount - lColumn)));
+
+	long long lHalf = lSide / 2;
+	LifeNode *nw = clipNode(life, node->nw, lRow, lColumn, lRowCount, lColumnCount);
+	LifeNode *ne = clipNode(life, node->ne, lRow, lColumn + lHalf, lRowCount, lColumnCount);
+	LifeNode *sw = clipNode(life, node->sw, lRow + lHalf, lColumn, lRowCount, lColumnCount);
+	LifeNode *se = clipNode(life, node->se, lRow + lHalf, lColumn + lHalf, lRowCount, lColumnCount);
+	return findNode(life, nw, ne, sw, se);
+}
+
+// Highest power of two up to uValue (uValue > 0)
+static int floorLog2(uint64_t uValue)
+{
+	int iLog = 0;
+	while(uValue >>= 1)
+		iLog++;
+	return iLog;
+}
+
+// Advance the torus of iRowCount * iColumnCount cells held by the root (of the level of patternLevel) by uGenerations
+// generations
+void advanceTorus(LifeHashLife &life, int iRowCount, int iColumnCount, uint64_t uGenerations)
+{
+	int iPowerOfTwo = !(iRowCount & (iRowCount - 1)) && !(iColumnCount & (iColumnCount - 1));
+	int p = life.root->iLevel;
+
+	if(iPowerOfTwo)
+	{
+		// A square node of a side of both periods (at least a leaf) holds the whole pattern
+		LifeNode *pattern = cutTorus(life, life.root, p, 0, 0, iRowCount, iColumnCount);
+		life.root = pattern;
+
+		while(uGenerations > 0)
+		{
+			// Copies of the pattern around it, so that the center of the window is the pattern again
+			int iStep = floorLog2(uGenerations);
+			int m = (p + 2 > iStep + 2) ? p + 2 : iStep + 2;
+			LifeNode *window = pattern;
+			for(int l = p; l < m; l++)
+				window = findNode(life, window, window, window, window);
+
+			pattern = advanceNode(life, window, iStep);
+			for(int l = m - 1; l > p; l--)
+				pattern = pattern->nw;
+			uGenerations -= (uint64_t) 1 << iStep;
+
+			life.root = pattern;
+			life.window = window;
+			if(life.iNodeCount > life.iMaxNodes)
+				collectGarbage(life);
+		}
+
+		// A single copy of the torus, dead beyond it
+		life.root = clipNode(life, pattern, 0, 0, iRowCount, iColumnCount);
+	}
+	else
+	{
+		// A window around the torus with a margin of a quarter of its side, good for up to 2^(m - 2) generations; its
+		// center is the torus again
+		int m = p + 1;
+		long long lMargin = 1ll << (m - 2);
+		long long lRow = (iRowCount - lMargin % iRowCount) % iRowCount, lColumn = (iColumnCount - lMargin % iColumnCount) % iColumnCount;
+
+		while(uGenerations > 0)
+		{
+			int iStep = floorLog2(uGenerations);
+			if(iStep > m - 2)
+				iStep = m - 2;
+
+			LifeNode *window = cutTorus(life, life.root, m, lRow, lColumn, iRowCount, iColumnCount);
+			life.root = clipNode(life, advanceNode(life, window, iStep), 0, 0, iRowCount, iColumnCount);
+			uGenerations -= (uint64_t) 1 << iStep;
+
+			life.window = window;
+			if(life.iNodeCount > life.iMaxNodes)
+				collectGarbage(life);
+		}
+	}
+}
+
+// The root in the center of a node of twice its side, the plane around it being dead
+static void expandRoot(LifeHashLife &life)
+{
+	LifeNode *root = life.root, *empty = emptyNode(life, root->iLevel - 1);
+	life.root = findNode(life, findNode(life, empty, empty, empty, root->nw), findNode(life, empty, empty, root->ne, empty),
+						 findNode(life, empty, root->sw, empty, empty), findNode(life, root->se, empty, empty, empty));
+
+	long long lShift = 1ll << (root->iLevel - 1);
+	life.lRowOrigin -= lShift;
+	life.lColumnOrigin -= lShift;
+}
+
+// Whether the live cells of the node (of level 5 at least) lie within its center, half its side
+static int isCentered(LifeHashLife &life, LifeNode *node)
+{
+	LifeNode *empty = emptyNode(life, node->iLevel - 2);
+	return node->nw->nw == empty && node->nw->ne == empty && node->nw->sw == empty
+		&& node->ne->nw == empty && node->ne->ne == empty && node->ne->se == empty
+		&& node->sw->nw == empty && node->sw->sw == empty && node->sw->se == empty
+		&& node->se->ne == empty && node->se->sw == empty && node->se->se == empty;
+}
+
+// Advance the pattern of the root on the unbounded plane by uGenerations generations, the root moving over the plane
+// (lRowOrigin, lColumnOrigin)
+void advancePlane(LifeHashLife &life, uint64_t uGenerations)
+{
+	// A leaf has no quadrants to center: it becomes the first quadrant of a node
+	if(life.root->iLevel == LIFE_LEAF_LEVEL)
+	{
+		LifeNode *empty = emptyNode(life, LIFE_LEAF_LEVEL);
+		life.root = findNode(life, life.root, empty, empty, empty);
+	}
+	while(life.root->iLevel < LIFE_LEAF_LEVEL + 2)
+		expandRoot(life);
+
+	while(uGenerations > 0)
+	{
+		int iStep = floorLog2(uGenerations);
+		if(iStep > LIFE_PLANE_MAX_STEP)
+			iStep = LIFE_PLANE_MAX_STEP;
+
+		// The live cells within the center quarter of a root of a side of 2^(iStep + 3) at least: the cells they reach
+		// lie within its center half, the result
+		while(life.root->iLevel < iStep + 2 || !isCentered(life, life.root))
+			expandRoot(life);
+		expandRoot(life);
+
+		LifeNode *window = life.root;
+		life.root = advanceNode(life, window, iStep);
+		life.lRowOrigin += 1ll << (window->iLevel - 2);
+		life.lColumnOrigin += 1ll << (window->iLevel - 2);
+		uGenerations -= (uint64_t) 1 << iStep;
+
+		// The dead margins are cut off again
+		while(life.root->iLevel > LIFE_LEAF_LEVEL + 2 && isCentered(life, life.root))
+		{
+			long long lShift = 1ll << (life.root->iLevel - 2);
+			life.root = centerNode(life, life.root);
+			life.lRowOrigin += lShift;
+			life.lColumnOrigin += lShift;
+		}
+
+		life.window = window;
+		if(life.iNodeCount > life.iMaxNodes)
+			collectGarbage(life);
+	}
+}
+
+// Join the live cells of the node at (lRow, lColumn) into the bounds (first row, last row + 1, first column, last column + 1)
+static void boundNode(LifeHashLife &life, LifeNode *node, long long lRow, long long lColumn, long long lBounds[4])
+{
+	long long lSide = 1ll << node->iLevel;
+	if(isEmpty(life, node) || (lRow >= lBounds[0] && lRow + lSide <= lBounds[1] && lColumn >= lBounds[2] && lColumn + lSide <= lBounds[3]))
+		return;
+
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+	{
+		for(int r = 0; r < 8; r++)
+		{
+			uint64_t uByte = (node->uCells >> (8 * r)) & 0xff;
+			if(!uByte)
+				continue;
+			if(lRow + r < lBounds[0])
+				lBounds[0] = lRow + r;
+			if(lRow + r + 1 > lBounds[1])
+				lBounds[1] = lRow + r + 1;
+			if(lColumn + __builtin_ctzll(uByte) < lBounds[2])
+				lBounds[2] = lColumn + __builtin_ctzll(uByte);
+			if(lColumn + 64 - __builtin_clzll(uByte) > lBounds[3])
+				lBounds[3] = lColumn + 64 - __builtin_clzll(uByte);
+		}
+		return;
+	}
+
+	long long lHalf = lSide / 2;
+	boundNode(life, node->nw, lRow, lColumn, lBounds);
+	boundNode(life, node->ne, lRow, lColumn + lHalf, lBounds);
+	boundNode(life, node->sw, lRow + lHalf, lColumn, lBounds);
+	boundNode(life, node->se, lRow + lHalf, lColumn + lHalf, lBounds);
+}
+
+// Bounds of the live cells of the node (first row, last row + 1, first column, last column + 1), 0 if there are none
+int findNodeBounds(LifeHashLife &life, LifeNode *node, long long lBounds[4])
+{
+	lBounds[0] = lBounds[2] = LLONG_MAX;
+	lBounds[1] = lBounds[3] = LLONG_MIN;
+	boundNode(life, node, 0, 0, lBounds);
+	return lBounds[1] > lBounds[0];
+}
+
+// Set the live cells of the node at (lRow, lColumn) lying in the band, whose cell (i, j) is the cell
+// (lRowStart + i, lColumnStart + j)
+static void bandNode(LifeHashLife &life, LifeNode *node, long long lRow, long long lColumn, LifeGrid &band, long long lRowStart,
+					 long long lColumnStart)
+{
+	long long lSide = 1ll << node->iLevel;
+	if(lRow >= lRowStart + band.iRowCount || lRow + lSide <= lRowStart || lColumn >= lColumnStart + band.iColumnCount
+	   || lColumn + lSide <= lColumnStart || isEmpty(life, node))
+		return;
+
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+	{
+		for(int r = 0; r < 8; r++)
+		{
+			long long i = lRow + r - lRowStart;
+			uint64_t uByte = (node->uCells >> (8 * r)) & 0xff;
+			for(; uByte && i >= 0 && i < band.iRowCount; uByte &= uByte - 1)
+			{
+				long long j = lColumn + __builtin_ctzll(uByte) - lColumnStart;
+				if(j >= 0 && j < band.iColumnCount)
+					setCell(band, (int) i, (int) j, 1);
+			}
+		}
+		return;
+	}
+
+	long long lHalf = lSide / 2;
+	bandNode(life, node->nw, lRow, lColumn, band, lRowStart, lColumnStart);
+	bandNode(life, node->ne, lRow, lColumn + lHalf, band, lRowStart, lColumnStart);
+	bandNode(life, node->sw, lRow + lHalf, lColumn, band, lRowStart, lColumnStart);
+	bandNode(life, node->se, lRow + lHalf, lColumn + lHalf, band, lRowStart, lColumnStart);
+}
+
+// The cells of the node in the band (a grid without outer layers): its cell (i, j) is the cell (lRowStart + i, lColumnStart + j)
+// of the node, the band is cleared first
+void extractBand(LifeHashLife &life, LifeNode *node, LifeGrid &band, long long lRowStart, long long lColumnStart)
+{
+	memset(band.uCells, 0, (LIFE_LINE_WORDS + (size_t) band.iRowCount * band.iStride) * sizeof(LifeWord));
+	bandNode(life, node, 0, 0, band, lRowStart, lColumnStart);
+}
+
+// Add the runs of live cells of the leaves of the node at (lRow, lColumn), relative to (lRowStart, lColumnStart)
+static void runsOfNode(LifeHashLife &life, LifeNode *node, long long lRow, long long lColumn, long long lRowStart, long long lColumnStart,
+					   LifeRun *&runs, long &lRunCount, long &lAllocated)
+{
+	if(isEmpty(life, node))
+		return;
+
+	if(node->iLevel == LIFE_LEAF_LEVEL)
+	{
+		for(int r = 0; r < 8; r++)
+		{
+			uint64_t uByte = (node->uCells >> (8 * r)) & 0xff;
+			while(uByte)
+			{
+				int iFirst = __builtin_ctzll(uByte), iCount = __builtin_ctzll(~(uByte >> iFirst));
+				uByte &= ~((((uint64_t) 1 << iCount) - 1) << iFirst);
+
+				if(lRunCount == lAllocated)
+				{
+					lAllocated = lAllocated ? 2 * lAllocated : 1024;
+					runs = (LifeRun *) realloc(runs, lAllocated * sizeof(LifeRun));
+					if(!runs)
+					{
+						cerr << "Unable to allocate the runs of HashLife" << endl;
+						abort();
+					}
+				}
+				runs[lRunCount].iRow = (int) (lRow + r - lRowStart);
+				runs[lRunCount].iColumn = (int) (lColumn + iFirst - lColumnStart);
+				runs[lRunCount].iCount = iCount;
+				lRunCount++;
+			}
+		}
+		return;
+	}
+
+	long long lHalf = 1ll << (node->iLevel - 1);
+	runsOfNode(life, node->nw, lRow, lColumn, lRowStart, lColumnStart, runs, lRunCount, lAllocated);
+	runsOfNode(life, node->ne, lRow, lColumn + lHalf, lRowStart, lColumnStart, runs, lRunCount, lAllocated);
+	runsOfNode(life, node->sw, lRow + lHalf, lColumn, lRowStart, lColumnStart, runs, lRunCount, lAllocated);
+	runsOfNode(life, node->se, lRow + lHalf, lColumn + lHalf, lRowStart, lColumnStart, runs, lRunCount, lAllocated);
+}
+
+// Runs of live cells of the node, a leaf row at a time, their rows and columns relative to the cell (lRowStart, lColumnStart)
+// of the node (which lies before all of them). Returns the number of runs, which are allocated and freed by the caller.
+long findNodeRuns(LifeHashLife &life, LifeNode *node, long long lRowStart, long long lColumnStart, LifeRun *&runs)
+{
+	long lRunCount = 0, lAllocated = 0;
+	runs = NULL;
+	runsOfNode(life, node, 0, 0, lRowStart, lColumnStart, runs, lRunCount, lAllocated);
+	return lRunCount;
+}
@@ -0,0 +1,126 @@
+/*
+ * The HashLife engine of the Game of Life.
+ *
+ * The grid is a quadtree: a node of level n holds 2^n * 2^n cells as four
+ * nodes of level (n - 1), a leaf (level 3) holds 8 * 8 cells in one word (row
+ * r in bits 8r .. 8r + 7). Equal nodes are stored only once (hash consing), so
+ * a node is known by its address. Every node remembers its result: the center
+ * of half its size 2^(n - 2) generations later, and the result of one smaller
+ * step as well. Repeated patterns in space and time are thus computed once.
+ *
+ * The pattern is built from its leaves (LifeLeaves), as given by the runs of
+ * an RLE pattern or the rows of a file, without a dense grid: only the nodes
+ * with live cells are made, so a few cells of a huge world take a few nodes.
+ * The state is the root node alone, and the outputs walk the tree.
+ *
+ * The torus of the other programs is a periodic pattern, held in a root whose
+ * side is the power of two at or above both sides, dead beyond them. When both
+ * sides are powers of two, the pattern repeats itself in a node which is tiled
+ * by four copies of itself, and any number of generations takes a logarithmic
+ * number of steps. Otherwise every step cuts a window around the torus out of
+ * the root, reusing its nodes wherever the window lines up with them and
+ * skipping the dead areas; the nodes it shares with the former windows keep
+ * their results. On the unbounded plane the root grows by dead margins until
+ * the step cannot reach its edges, and shrinks back around the live cells.
+ *
+ * The nodes are allocated in blocks. Beyond iMaxNodes the nodes which are not
+ * reachable from the current pattern are freed between two steps, the results
+ * first, the whole cache if that is not enough.
+ *
+ * The leaves are computed by the word kernel of the rule of the run
+ * (setKernelRule), which must not change once the first result is cached.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+#if !defined LIFE_HASHLIFE_H
+#define LIFE_HASHLIFE_H
+
+// Including libraries
+#include <stdint.h>
+#include <stddef.h>
+
+// Including the bit-packed grid and the runs of the RLE patterns
+#include "life_grid.h"
+#include "life_rle.h"
+
+// Level of a leaf (8 * 8 cells) and the highest level
+#define LIFE_LEAF_LEVEL 3
+#define LIFE_MAX_LEVEL 64
+
+// Nodes allocated at once
+#define LIFE_NODE_BLOCK 4096
+
+// Largest step on the plane (2^LIFE_PLANE_MAX_STEP generations), the coordinates stay within 64 bits
+#define LIFE_PLANE_MAX_STEP 48
+
+// Node of the quadtree
+struct LifeNode
+{
+	LifeNode *nw, *ne, *sw, *se;	// Quadrants (none for a leaf)
+	uint64_t uCells;				// Cells of a leaf
+	LifeNode *result;				// Center 2^(iLevel - 2) generations later
+	LifeNode *stepResult;			// Center 2^iStep generations later
+	LifeNode *next;					// Next node of the same hash bucket (or of the free nodes)
+	int iLevel;						// Level of the node
+	int iStep;						// Step of stepResult
+	int iMark;						// Reachable during the garbage collection
+};
+
+// Nodes, their hash table and the memory bound
+struct LifeHashLife
+{
+	LifeNode **buckets;					// Hash table
+	size_t iBucketCount;				// Number of buckets (a power of two)
+	size_t iNodeCount;					// Nodes in the hash table
+	size_t iMaxNodes;					// Nodes before the garbage collection
+	LifeNode *freeNodes;				// Free nodes
+	void **blocks;						// Allocated blocks of nodes
+	size_t iBlockCount;
+	LifeNode *empty[LIFE_MAX_LEVEL];	// Empty node of every level
+	LifeNode *root;						// Current pattern (kept by the garbage collection)
+	LifeNode *window;					// Window of the last step (kept as well)
+	long long lRowOrigin;				// Row of the plane of the first cell of the root (unbounded plane)
+	long long lColumnOrigin;			// Column of the plane of the first cell of the root
+	long lCollections;					// Garbage collections so far
+};
+
+// Cells of a leaf of a pattern being built, at the row and column of the leaves (eight cells each)
+struct LifeLeaf
+{
+	long long lRow;
+	long long lColumn;
+	uint64_t uCells;
+};
+
+// Leaves of a pattern being built, in any order
+struct LifeLeaves
+{
+	LifeLeaf *leaves;
+	long lCount;
+	long lAllocated;
+};
+
+// Signature of the methods
+void createHashLife(LifeHashLife &life, size_t iMemoryBytes);
+void freeHashLife(LifeHashLife &life);
+LifeNode *findLeaf(LifeHashLife &life, uint64_t uCells);
+LifeNode *findNode(LifeHashLife &life, LifeNode *nw, LifeNode *ne, LifeNode *sw, LifeNode *se);
+LifeNode *emptyNode(LifeHashLife &life, int iLevel);
+LifeNode *advanceNode(LifeHashLife &life, LifeNode *node, int iStep);
+void collectGarbage(LifeHashLife &life);
+void createLeaves(LifeLeaves &leaves);
+void addLeaf(LifeLeaves &leaves, long long lRow, long long lColumn, uint64_t uCells);
+void addBand(LifeLeaves &leaves, long long lRow, uint64_t *uBand, long long lLeafCount);
+void addRun(LifeLeaves &leaves, long long lRow, long long lColumn, long long lCount);
+int patternLevel(long long lRowCount, long long lColumnCount);
+LifeNode *buildPattern(LifeHashLife &life, LifeLeaves &leaves, int iLevel);
+void advanceTorus(LifeHashLife &life, int iRowCount, int iColumnCount, uint64_t uGenerations);
+void advancePlane(LifeHashLife &life, uint64_t uGenerations);
+int findNodeBounds(LifeHashLife &life, LifeNode *node, long long lBounds[4]);
+void extractBand(LifeHashLife &life, LifeNode *node, LifeGrid &band, long long lRowStart, long long lColumnStart);
+long findNodeRuns(LifeHashLife &life, LifeNode *node, long long lRowStart, long long lColumnStart, LifeRun *&runs);
+
+#endif
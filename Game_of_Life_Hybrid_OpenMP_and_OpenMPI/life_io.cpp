@@ -0,0 +1,387 @@
+/*
+ * Parallel input and output of the Game of Life through MPI-IO.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the parallel input
+#include "life_io.h"
+
+// Bytes of a row of the fixed-width format: a digit and a blank per cell and the line end
+static MPI_Offset rowBytes(int iColumnCount)
+{
+	return 2 * (MPI_Offset) iColumnCount + 1;
+}
+
+// Whether the file behind the first line holds exactly the rows of the fixed-width format
+int isFixedWidthInput(MPI_File file, MPI_Offset iHeaderSize, int iRowCount, int iColumnCount)
+{
+	MPI_Offset iFileSize;
+	MPI_File_get_size(file, &iFileSize);
+
+	return iFileSize == iHeaderSize + iRowCount * rowBytes(iColumnCount);
+}
+
+// Read the block of the process into its grid (the halos are left alone).
+// Collective: every process of the domain calls it.
+void readBlock(MPI_File file, MPI_Offset iHeaderSize, int iGlobalRowCount, int iGlobalColumnCount, const LifeDomain &domain, LifeGrid &grid)
+{
+	// The block of the process in the file: its rows, and the digits and blanks of its columns
+	int iSizes[2] = { iGlobalRowCount, (int) rowBytes(iGlobalColumnCount) };
+	int iSubSizes[2] = { domain.iRowCount, 2 * domain.iColumnCount };
+	int iStarts[2] = { domain.iRowStart - 1, 2 * (domain.iColumnStart - 1) };
+
+	MPI_Datatype blockType;
+	MPI_Type_create_subarray(2, iSizes, iSubSizes, iStarts, MPI_ORDER_C, MPI_CHAR, &blockType);
+	MPI_Type_commit(&blockType);
+	MPI_File_set_view(file, iHeaderSize, MPI_CHAR, blockType, "native", MPI_INFO_NULL);
+
+	// Rows are read in batches to keep the text buffer small. All processes take part
+	// in every collective read, the number of batches follows from the tallest block.
+	int iTallestBlock = tallestBlock(domain);
+	int iBatches = (iTallestBlock + LIFE_IO_ROWS - 1) / LIFE_IO_ROWS;
+	int iRowBytes = 2 * domain.iColumnCount;
+	char *cBuffer = (char *) malloc((size_t) LIFE_IO_ROWS * iRowBytes);
+
+	// Counted in whole rows, the count stays small however wide the rows are
+	MPI_Datatype rowType;
+	MPI_Type_contiguous(iRowBytes, MPI_CHAR, &rowType);
+	MPI_Type_commit(&rowType);
+
+	for(int b = 0; b < iBatches; b++)
+	{
+		int iFirstRow = b * LIFE_IO_ROWS;
+		int iRows = domain.iRowCount - iFirstRow;
+		if(iRows > LIFE_IO_ROWS)
+			iRows = LIFE_IO_ROWS;
+		if(iRows < 0)
+			iRows = 0;
+
+		MPI_File_read_at_all(file, (MPI_Offset) iFirstRow * iRowBytes, cBuffer, iRows, rowType, MPI_STATUS_IGNORE);
+
+		// Every second character is a cell
+		for(int i = 0; i < iRows; i++)
+			for(int j = 0; j < domain.iColumnCount; j++)
+				setCell(grid, domain.iDepth + iFirstRow + i, domain.iDepth + j, cBuffer[(size_t) i * iRowBytes + 2 * j] - '0');
+	}
+
+	free(cBuffer);
+	MPI_Type_free(&rowType);
+	MPI_Type_free(&blockType);
+}
+
+// Whether the output goes to a binary grid file (a file name ending in ".bin")
+int isBinaryOutput(const char *sFileName)
+{
+	size_t iLength = strlen(sFileName);
+	return iLength >= 4 && strcmp(sFileName + iLength - 4, ".bin") == 0;
+}
+
+// Write the block of the process (without the halos of its grid) in the fixed-width format.
+// Collective: every process of the domain calls it.
+void writeBlock(MPI_File file, int iGlobalRowCount, int iGlobalColumnCount, const LifeDomain &domain, const LifeGrid &grid)
+{
+	// The blocks of the last column of processes write the line ends as well
+	int iLineEnd = (domain.iCoords[1] == domain.iDims[1] - 1) ? 1 : 0;
+	int iRowBytes = 2 * domain.iColumnCount + iLineEnd;
+
+	int iSizes[2] = { iGlobalRowCount, (int) rowBytes(iGlobalColumnCount) };
+	int iSubSizes[2] = { domain.iRowCount, iRowBytes };
+	int iStarts[2] = { domain.iRowStart - 1, 2 * (domain.iColumnStart - 1) };
+
+	MPI_Datatype blockType;
+	MPI_Type_create_subarray(2, iSizes, iSubSizes, iStarts, MPI_ORDER_C, MPI_CHAR, &blockType);
+	MPI_Type_commit(&blockType);
+	MPI_File_set_view(file, 0, MPI_CHAR, blockType, "native", MPI_INFO_NULL);
+
+	// Rows are written in batches, as many collective writes on every process
+	int iTallestBlock = tallestBlock(domain);
+	int iBatches = (iTallestBlock + LIFE_IO_ROWS - 1) / LIFE_IO_ROWS;
+	char *cBuffer = (char *) malloc((size_t) LIFE_IO_ROWS * iRowBytes);
+
+	MPI_Datatype rowType;
+	MPI_Type_contiguous(iRowBytes, MPI_CHAR, &rowType);
+	MPI_Type_commit(&rowType);
+
+	for(int b = 0; b < iBatches; b++)
+	{
+		int iFirstRow = b * LIFE_IO_ROWS;
+		int iRows = domain.iRowCount - iFirstRow;
+		if(iRows > LIFE_IO_ROWS)
+			iRows = LIFE_IO_ROWS;
+		if(iRows < 0)
+			iRows = 0;
+
+		for(int i = 0; i < iRows; i++)
+		{
+			char *cRow = cBuffer + (size_t) i * iRowBytes;
+			for(int j = 0; j < domain.iColumnCount; j++)
+			{
+				cRow[2 * j] = (char) ('0' + getCell(grid, domain.iDepth + iFirstRow + i, domain.iDepth + j));
+				cRow[2 * j + 1] = ' ';
+			}
+			if(iLineEnd)
+				cRow[iRowBytes - 1] = '\n';
+		}
+
+		MPI_File_write_at_all(file, (MPI_Offset) iFirstRow * iRowBytes, cBuffer, iRows, rowType, MPI_STATUS_IGNORE);
+	}
+
+	free(cBuffer);
+	MPI_Type_free(&rowType);
+	MPI_Type_free(&blockType);
+}
+
+// Read the block of the process from a mapped grid file and check the checksum of the whole file.
+// Collective: every process of the domain calls it, returns 0 on all of them when the checksum differs.
+int readBlockFile(const LifeFile &file, const LifeDomain &domain, LifeGrid &grid)
+{
+	readRows(file, grid, domain.iDepth, domain.iDepth, domain.iRowStart - 1, domain.iRowCount, domain.iColumnStart - 1, domain.iColumnCount);
+
+	// Rows are checked whole, once per row of blocks
+	uint64_t uChecksum = 0, uTotal = 0;
+	if(domain.iCoords[1] == 0)
+		uChecksum = checksumRows(file, domain.iRowStart - 1, domain.iRowStart - 1 + domain.iRowCount);
+	MPI_Allreduce(&uChecksum, &uTotal, 1, MPI_UINT64_T, MPI_SUM, domain.cartComm);
+
+	return uTotal == file.header.uChecksum;
+}
+
+// Datatype of iRowCount whole rows of iRowBytes bytes behind iHeaderBytes bytes, so that a count of 1 covers
+// a slab of any size (an int count of bytes ends at 2 GiB)
+static MPI_Datatype createSlabType(size_t iHeaderBytes, int iRowCount, size_t iRowBytes)
+{
+	MPI_Datatype rowType, slabType;
+	MPI_Type_contiguous((int) iRowBytes, MPI_BYTE, &rowType);
+
+	int iBlockLengths[2] = { (int) iHeaderBytes, iRowCount };
+	MPI_Aint iDisplacements[2] = { 0, (MPI_Aint) iHeaderBytes };
+	MPI_Datatype types[2] = { MPI_BYTE, rowType };
+	MPI_Type_create_struct(2, iBlockLengths, iDisplacements, types, &slabType);
+	MPI_Type_commit(&slabType);
+	MPI_Type_free(&rowType);
+
+	return slabType;
+}
+
+// Bytes packBlockFile puts into the buffer of the process: the slab of its row of blocks on the first
+// process of the row, with the header in front on process 0, none on the other processes
+size_t blockFileBytes(const LifeDomain &domain, int iGlobalColumnCount)
+{
+	if(domain.iCoords[1] != 0)
+		return 0;
+
+	int iRank;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+	return ((iRank == 0) ? sizeof(LifeFileHeader) : 0) + domain.iRowCount * lifeRowBytes(iGlobalColumnCount);
+}
+
+// Pack the block of the process into the bytes of a binary grid file of the generation uGeneration, in
+// cBuffer of blockFileBytes bytes. The blocks of a row of processes are joined on its first process,
+// process 0 puts the header in front of its rows. Returns the offset of the bytes in the file and
+// slabType, the datatype of the bytes with a count of 1, which the caller frees (the other processes
+// get no bytes and write a count of 0).
+// Collective: every process of the domain calls it.
+MPI_Offset packBlockFile(const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount,
+						 uint64_t uGeneration, unsigned char *cBuffer, MPI_Datatype &slabType)
+{
+	// Processes of the same row of blocks
+	MPI_Comm rowComm;
+	int iRemainDims[2] = { 0, 1 };
+	MPI_Cart_sub(domain.cartComm, iRemainDims, &rowComm);
+
+	int iRank;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+
+	LifeFileHeader header;
+	initHeader(header, iGlobalRowCount, iGlobalColumnCount, uGeneration);
+
+	size_t iRowBytes = lifeRowBytes(iGlobalColumnCount);
+	size_t iHeaderBytes = (iRank == 0) ? header.uHeaderSize : 0;
+	uint64_t uChecksum = 0;
+
+	if(domain.iCoords[1] == 0)
+	{
+		// The first process of the row joins the blocks into a slab of whole rows, the cells from bit 0 on
+		LifeGrid gridSlab;
+		allocateGrid(gridSlab, domain.iRowCount, iGlobalColumnCount);
+		copyBlock(gridSlab, 0, 0, grid, domain.iDepth, domain.iDepth, domain.iRowCount, domain.iColumnCount);
+
+		for(int k = 1; k < domain.iDims[1]; k++)
+		{
+			int iColumnStart = domain.iColumnStarts[k], iColumnSize = domain.iColumnStarts[k + 1] - iColumnStart;
+
+			// The block is received into a grid of its own
+			LifeGrid gridBlock;
+			allocateGrid(gridBlock, domain.iRowCount, iColumnSize + 2 * domain.iDepth);
+			MPI_Datatype strideType;
+			MPI_Type_contiguous(gridBlock.iStride, MPI_UINT64_T, &strideType);
+			MPI_Type_commit(&strideType);
+			MPI_Recv(getRow(gridBlock, 0), domain.iRowCount, strideType, k, 1, rowComm, MPI_STATUS_IGNORE);
+			MPI_Type_free(&strideType);
+			copyBlock(gridSlab, 0, iColumnStart - 1, gridBlock, 0, domain.iDepth, domain.iRowCount, iColumnSize);
+			freeGrid(gridBlock);
+		}
+
+		// Rows of the file and their checksums
+		for(int i = 0; i < domain.iRowCount; i++)
+		{
+			unsigned char *cRow = cBuffer + iHeaderBytes + (size_t) i * iRowBytes;
+			packRow(gridSlab, i, 0, iGlobalColumnCount, cRow);
+			uChecksum += checksumRow(cRow, iRowBytes, (uint64_t) (domain.iRowStart - 1 + i));
+		}
+		freeGrid(gridSlab);
+	}
+	else
+	{
+		// Sending the rows of the block straight out of the grid, counted in whole rows
+		MPI_Datatype strideType;
+		MPI_Type_contiguous(grid.iStride, MPI_UINT64_T, &strideType);
+		MPI_Type_commit(&strideType);
+		MPI_Send(getRow(grid, domain.iDepth), domain.iRowCount, strideType, 0, 1, rowComm);
+		MPI_Type_free(&strideType);
+	}
+	MPI_Comm_free(&rowComm);
+
+	// The header carries the checksum of all rows
+	MPI_Reduce(&uChecksum, &header.uChecksum, 1, MPI_UINT64_T, MPI_SUM, 0, domain.cartComm);
+	if(iRank == 0)
+		storeHeader(header, cBuffer);
+
+	if(domain.iCoords[1] != 0)
+	{
+		slabType = createSlabType(0, 0, iRowBytes);
+		return 0;
+	}
+	slabType = createSlabType(iHeaderBytes, domain.iRowCount, iRowBytes);
+	return header.uHeaderSize - iHeaderBytes + (MPI_Offset) (domain.iRowStart - 1) * iRowBytes;
+}
+
+// Start to gather the rows of all blocks on process 0, packed as in a binary grid file (for a frame of the snapshot stream).
+// The block is packed at once, the grid may change as soon as it returns; the rows travel while the next generations are
+// computed, finishGatherRows completes the gather.
+// Collective: every process of the domain calls it.
+void startGatherRows(LifeGather &gather, const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount)
+{
+	// The first process of every row of blocks holds a slab of whole rows, process 0 the header in front of its own
+	gather.cBuffer = (unsigned char *) malloc(blockFileBytes(domain, iGlobalColumnCount));
+	MPI_Datatype slabType;
+	packBlockFile(domain, grid, iGlobalRowCount, iGlobalColumnCount, 0, gather.cBuffer, slabType);
+	MPI_Type_free(&slabType);
+
+	int iRank, iProcesses;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+	MPI_Comm_size(domain.cartComm, &iProcesses);
+
+	// Slabs are counted and placed in whole rows, the counts and offsets stay small however large the grid is
+	size_t iRowBytes = lifeRowBytes(iGlobalColumnCount);
+	size_t iHeaderBytes = (iRank == 0) ? sizeof(LifeFileHeader) : 0;
+	MPI_Type_contiguous((int) iRowBytes, MPI_BYTE, &gather.rowType);
+	MPI_Type_commit(&gather.rowType);
+
+	// The slabs of the rows of blocks into place, their boundaries are known to all processes
+	gather.iCounts = gather.iOffsets = NULL;
+	gather.cRows = NULL;
+	if(iRank == 0)
+	{
+		gather.iCounts = (int *) malloc(iProcesses * sizeof(int));
+		gather.iOffsets = (int *) malloc(iProcesses * sizeof(int));
+		gather.cRows = (unsigned char *) malloc(iGlobalRowCount * iRowBytes);
+		for(int p = 0; p < iProcesses; p++)
+		{
+			int iCoords[2];
+			MPI_Cart_coords(domain.cartComm, p, 2, iCoords);
+			gather.iOffsets[p] = domain.iRowStarts[iCoords[0]] - 1;
+			gather.iCounts[p] = (iCoords[1] == 0) ? domain.iRowStarts[iCoords[0] + 1] - domain.iRowStarts[iCoords[0]] : 0;
+		}
+	}
+	int iSlabRows = (domain.iCoords[1] == 0) ? domain.iRowCount : 0;
+	MPI_Igatherv(gather.cBuffer + iHeaderBytes, iSlabRows, gather.rowType, gather.cRows, gather.iCounts, gather.iOffsets,
+				 gather.rowType, 0, domain.cartComm, &gather.request);
+}
+
+// Complete the gather of startGatherRows. Returns the rows on process 0, which frees them, NULL on the other processes.
+unsigned char *finishGatherRows(LifeGather &gather)
+{
+	MPI_Wait(&gather.request, MPI_STATUS_IGNORE);
+
+	MPI_Type_free(&gather.rowType);
+	free(gather.cBuffer);
+	free(gather.iCounts);
+	free(gather.iOffsets);
+	return gather.cRows;
+}
+
+// Gather the rows of all blocks on process 0 at once, as startGatherRows and finishGatherRows do.
+// Returns the rows on process 0, which frees them, NULL on the other processes.
+// Collective: every process of the domain calls it.
+unsigned char *gatherRows(const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount)
+{
+	LifeGather gather;
+	startGatherRows(gather, domain, grid, iGlobalRowCount, iGlobalColumnCount);
+	return finishGatherRows(gather);
+}
+
+// Gather the runs of live cells of all blocks on process 0 (for an RLE pattern), rows and columns counting from 0.
+// Returns the runs on process 0, which frees them, NULL on the other processes; lRunCount is their number on process 0.
+// Collective: every process of the domain calls it.
+LifeRun *gatherRuns(const LifeDomain &domain, const LifeGrid &grid, long &lRunCount)
+{
+	LifeRun *runs;
+	int iRunInts = (int) (findRuns(grid, domain.iDepth, domain.iRowCount, domain.iDepth, domain.iColumnCount,
+								   domain.iRowStart - 1, domain.iColumnStart - 1, runs) * 3);
+
+	int iRank, iProcesses;
+	MPI_Comm_rank(domain.cartComm, &iRank);
+	MPI_Comm_size(domain.cartComm, &iProcesses);
+
+	// Every run is three integers
+	int *iCounts = NULL, *iOffsets = NULL;
+	LifeRun *allRuns = NULL;
+	if(iRank == 0)
+	{
+		iCounts = (int *) malloc(iProcesses * sizeof(int));
+		iOffsets = (int *) malloc(iProcesses * sizeof(int));
+	}
+	MPI_Gather(&iRunInts, 1, MPI_INT, iCounts, 1, MPI_INT, 0, domain.cartComm);
+	lRunCount = 0;
+	if(iRank == 0)
+	{
+		for(int p = 0; p < iProcesses; p++)
+		{
+			iOffsets[p] = (int) lRunCount;
+			lRunCount += iCounts[p];
+		}
+		allRuns = (LifeRun *) malloc((lRunCount / 3 + 1) * sizeof(LifeRun));
+		lRunCount /= 3;
+	}
+	MPI_Gatherv(runs, iRunInts, MPI_INT, allRuns, iCounts, iOffsets, MPI_INT, 0, domain.cartComm);
+
+	free(runs);
+	free(iCounts);
+	free(iOffsets);
+	return allRuns;
+}
+
+// Write the block of the process as a binary grid file of the generation uGeneration.
+// Collective: every process of the domain calls it.
+void writeBlockBinary(MPI_File file, int iGlobalRowCount, int iGlobalColumnCount, uint64_t uGeneration, const LifeDomain &domain, const LifeGrid &grid)
+{
+	size_t iBufferSize = blockFileBytes(domain, iGlobalColumnCount);
+	unsigned char *cBuffer = (unsigned char *) malloc(iBufferSize);
+	MPI_Datatype slabType;
+	MPI_Offset iOffset = packBlockFile(domain, grid, iGlobalRowCount, iGlobalColumnCount, uGeneration, cBuffer, slabType);
+
+	// Every slab lands at its own offset, the other processes write nothing
+	MPI_File_set_view(file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+	MPI_File_write_at_all(file, iOffset, cBuffer, (iBufferSize > 0) ? 1 : 0, slabType, MPI_STATUS_IGNORE);
+
+	MPI_Type_free(&slabType);
+	free(cBuffer);
+}
@@ -0,0 +1,74 @@
+/*
+ * Parallel input and output of the Game of Life through MPI-IO.
+ *
+ * The fixed-width text format keeps the first line of the grid dimension and
+ * writes every row on a line of its own, each cell as "0 " or "1 ":
+ *
+ *		4 4
+ *		0 0 1 0 
+ *		1 1 0 1 
+ *		...
+ *
+ * Every row takes (2 * iColumnCount + 1) bytes, so every process finds its
+ * block in the file and all processes read their blocks at once with a
+ * collective read (MPI_File_read_at_all). The final generation is written the
+ * same way (MPI_File_write_at_all), without the first line.
+ *
+ * The binary output is a grid file of life_file.h, one bit per cell. The
+ * blocks of a row of processes are joined into one slab of whole rows first,
+ * as the blocks do not start on whole bytes. A grid file is read from its
+ * memory mapping by every process.
+ *
+ * A frame of the snapshot stream (life_stream.h) gathers the slabs of the
+ * binary output on process 0 instead of writing them, with a non-blocking
+ * gather (MPI_Igatherv) which the next generations overlap. An RLE pattern
+ * (life_rle.h) gathers the runs of live cells of the blocks on process 0
+ * instead: a sparse grid sends a few of them rather than its rows.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.3 10/18/2026
+ *
+ */
+
+#if !defined LIFE_IO_H
+#define LIFE_IO_H
+
+// Including libraries
+#include <mpi.h>
+
+// Including the bit-packed grid, its decomposition and the binary grid file
+#include "life_grid.h"
+#include "life_domain.h"
+#include "life_file.h"
+#include "life_rle.h"
+
+// Rows read or written by a process at once
+#define LIFE_IO_ROWS 256
+
+// A gather of the rows of all blocks on process 0 in flight
+struct LifeGather
+{
+	unsigned char *cBuffer;			// Packed block of the process
+	unsigned char *cRows;			// Rows of all blocks (process 0)
+	int *iCounts;					// Rows of the slab of every process (process 0)
+	int *iOffsets;					// First row of the slab of every process (process 0)
+	MPI_Datatype rowType;			// A whole row of the grid file
+	MPI_Request request;			// The gather in flight
+};
+
+// Signature of the methods
+int isFixedWidthInput(MPI_File file, MPI_Offset iHeaderSize, int iRowCount, int iColumnCount);
+void readBlock(MPI_File file, MPI_Offset iHeaderSize, int iGlobalRowCount, int iGlobalColumnCount, const LifeDomain &domain, LifeGrid &grid);
+int isBinaryOutput(const char *sFileName);
+void writeBlock(MPI_File file, int iGlobalRowCount, int iGlobalColumnCount, const LifeDomain &domain, const LifeGrid &grid);
+size_t blockFileBytes(const LifeDomain &domain, int iGlobalColumnCount);
+MPI_Offset packBlockFile(const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount,
+						 uint64_t uGeneration, unsigned char *cBuffer, MPI_Datatype &slabType);
+void startGatherRows(LifeGather &gather, const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount);
+unsigned char *finishGatherRows(LifeGather &gather);
+unsigned char *gatherRows(const LifeDomain &domain, const LifeGrid &grid, int iGlobalRowCount, int iGlobalColumnCount);
+LifeRun *gatherRuns(const LifeDomain &domain, const LifeGrid &grid, long &lRunCount);
+int readBlockFile(const LifeFile &file, const LifeDomain &domain, LifeGrid &grid);
+void writeBlockBinary(MPI_File file, int iGlobalRowCount, int iGlobalColumnCount, uint64_t uGeneration, const LifeDomain &domain, const LifeGrid &grid);
+
+#endif
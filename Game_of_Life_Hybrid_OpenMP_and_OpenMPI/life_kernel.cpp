@@ -0,0 +1,278 @@
+/*
+ * The next generation kernel of the bit-packed grid.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// nextWord is always inlined into the vector kernels, the vector ABI of its arguments never matters
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// Including the kernel
+#include "life_kernel.h"
+
+// Masks of the rule when it has no kernels of its own (see nextWordMasks)
+static LifeWord uRuleMasks[LIFE_RULE_MASKS];
+
+// Row of words, Vector words at a time (the rest of the row word by word), under the rule uBirth / uSurvival
+// or under the masks of the rule (LIFE_RULE_ANY)
+template<typename Vector, unsigned uBirth, unsigned uSurvival>
+static inline __attribute__((always_inline)) void nextRow(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+														  LifeWord *uRowNew, int iWordCount)
+{
+	const int iLanes = sizeof(Vector) / sizeof(LifeWord);
+	int w = 0;
+
+	// The masks are read once per row
+	LifeWord uMasks[LIFE_RULE_MASKS];
+	if(uBirth == LIFE_RULE_ANY)
+		memcpy(uMasks, uRuleMasks, sizeof(uMasks));
+
+	for(; w + iLanes <= iWordCount; w += iLanes)
+	{
+		// Unaligned loads of the words left and right are just the row shifted by one word
+		Vector a0, a1, a2, b0, b1, b2, c0, c1, c2;
+		memcpy(&a0, uAbove + w - 1, sizeof(Vector));
+		memcpy(&a1, uAbove + w, sizeof(Vector));
+		memcpy(&a2, uAbove + w + 1, sizeof(Vector));
+		memcpy(&b0, uRow + w - 1, sizeof(Vector));
+		memcpy(&b1, uRow + w, sizeof(Vector));
+		memcpy(&b2, uRow + w + 1, sizeof(Vector));
+		memcpy(&c0, uBelow + w - 1, sizeof(Vector));
+		memcpy(&c1, uBelow + w, sizeof(Vector));
+		memcpy(&c2, uBelow + w + 1, sizeof(Vector));
+
+		Vector uNew;
+		if(uBirth == LIFE_RULE_ANY)
+			uNew = nextWordMasks(uMasks, a0, a1, a2, b0, b1, b2, c0, c1, c2);
+		else
+			uNew = nextWordRule<uBirth, uSurvival>(a0, a1, a2, b0, b1, b2, c0, c1, c2);
+		memcpy(uRowNew + w, &uNew, sizeof(Vector));
+	}
+
+	for(; w < iWordCount; w++)
+	{
+		if(uBirth == LIFE_RULE_ANY)
+			uRowNew[w] = nextWordMasks(uMasks, uAbove[w - 1], uAbove[w], uAbove[w + 1],
+									   uRow[w - 1], uRow[w], uRow[w + 1], uBelow[w - 1], uBelow[w], uBelow[w + 1]);
+		else
+			uRowNew[w] = nextWordRule<uBirth, uSurvival>(uAbove[w - 1], uAbove[w], uAbove[w + 1],
+														 uRow[w - 1], uRow[w], uRow[w + 1], uBelow[w - 1], uBelow[w], uBelow[w + 1]);
+	}
+}
+
+// Scalar kernel, one word at a time
+template<unsigned uBirth, unsigned uSurvival>
+static void nextRowScalar(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+						  LifeWord *uRowNew, int iWordCount)
+{
+	nextRow<LifeWord, uBirth, uSurvival>(uAbove, uRow, uBelow, uRowNew, iWordCount);
+}
+
+// One word
+template<unsigned uBirth, unsigned uSurvival>
+static LifeWord nextWordScalar(LifeWord a0, LifeWord a1, LifeWord a2, LifeWord b0, LifeWord b1, LifeWord b2,
+							   LifeWord c0, LifeWord c1, LifeWord c2)
+{
+	if(uBirth == LIFE_RULE_ANY)
+		return nextWordMasks(uRuleMasks, a0, a1, a2, b0, b1, b2, c0, c1, c2);
+	return nextWordRule<uBirth, uSurvival>(a0, a1, a2, b0, b1, b2, c0, c1, c2);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Vectors of 2, 4 and 8 words
+typedef LifeWord LifeVector2 __attribute__((vector_size(16)));
+typedef LifeWord LifeVector4 __attribute__((vector_size(32)));
+typedef LifeWord LifeVector8 __attribute__((vector_size(64)));
+
+// SSE2 kernel, two words at a time
+template<unsigned uBirth, unsigned uSurvival>
+__attribute__((target("sse2")))
+static void nextRowSSE2(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+						LifeWord *uRowNew, int iWordCount)
+{
+	nextRow<LifeVector2, uBirth, uSurvival>(uAbove, uRow, uBelow, uRowNew, iWordCount);
+}
+
+// AVX2 kernel, four words at a time
+template<unsigned uBirth, unsigned uSurvival>
+__attribute__((target("avx2")))
+static void nextRowAVX2(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+						LifeWord *uRowNew, int iWordCount)
+{
+	nextRow<LifeVector4, uBirth, uSurvival>(uAbove, uRow, uBelow, uRowNew, iWordCount);
+}
+
+// AVX-512 kernel, eight words at a time
+template<unsigned uBirth, unsigned uSurvival>
+__attribute__((target("avx512f")))
+static void nextRowAVX512(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+						  LifeWord *uRowNew, int iWordCount)
+{
+	nextRow<LifeVector8, uBirth, uSurvival>(uAbove, uRow, uBelow, uRowNew, iWordCount);
+}
+
+#endif
+
+// Kernels from the widest to the narrowest
+struct LifeKernelEntry
+{
+	const char *cName;
+	int (*supported)();
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+static int supportsAVX512() { return __builtin_cpu_supports("avx512f"); }
+static int supportsAVX2() { return __builtin_cpu_supports("avx2"); }
+static int supportsSSE2() { return __builtin_cpu_supports("sse2"); }
+#endif
+static int supportsScalar() { return 1; }
+
+static const LifeKernelEntry kernelEntries[] =
+{
+#if defined(__x86_64__) || defined(__i386__)
+	{ "avx512", supportsAVX512 },
+	{ "avx2", supportsAVX2 },
+	{ "sse2", supportsSSE2 },
+#endif
+	{ "scalar", supportsScalar }
+};
+
+#define LIFE_KERNEL_COUNT ((int) (sizeof(kernelEntries) / sizeof(kernelEntries[0])))
+
+// Kernels of a rule, in the order of kernelEntries
+struct LifeRuleKernels
+{
+	unsigned uBirth;
+	unsigned uSurvival;
+	LifeRowKernel rowKernels[sizeof(kernelEntries) / sizeof(kernelEntries[0])];
+	LifeWordKernel wordKernel;
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LIFE_RULE_KERNELS(uBirth, uSurvival) \
+	{ uBirth, uSurvival, { nextRowAVX512<uBirth, uSurvival>, nextRowAVX2<uBirth, uSurvival>, nextRowSSE2<uBirth, uSurvival>, \
+						   nextRowScalar<uBirth, uSurvival> }, nextWordScalar<uBirth, uSurvival> }
+#else
+#define LIFE_RULE_KERNELS(uBirth, uSurvival) \
+	{ uBirth, uSurvival, { nextRowScalar<uBirth, uSurvival> }, nextWordScalar<uBirth, uSurvival> }
+#endif
+
+// The rules of life_rule.cpp known by their name have kernels of their own, the last kernels take any rule
+static const LifeRuleKernels ruleKernels[] =
+{
+	LIFE_RULE_KERNELS(0x008, 0x00c),	// B3/S23
+	LIFE_RULE_KERNELS(0x048, 0x00c),	// B36/S23
+	LIFE_RULE_KERNELS(0x1c8, 0x1d8),	// B3678/S34678
+	LIFE_RULE_KERNELS(0x004, 0x000),	// B2/S
+	LIFE_RULE_KERNELS(0x008, 0x1ff),	// B3/S012345678
+	LIFE_RULE_KERNELS(0x008, 0x03e),	// B3/S12345
+	LIFE_RULE_KERNELS(0x0aa, 0x0aa),	// B1357/S1357
+	LIFE_RULE_KERNELS(0x048, 0x026),	// B36/S125
+	LIFE_RULE_KERNELS(0x018, 0x018),	// B34/S34
+	LIFE_RULE_KERNELS(0x148, 0x034),	// B368/S245
+	LIFE_RULE_KERNELS(0x1d0, 0x1e8),	// B4678/S35678
+	LIFE_RULE_KERNELS(LIFE_RULE_ANY, LIFE_RULE_ANY)
+};
+
+// Kernels of the rule of the run, the Game of Life unless set otherwise
+static const LifeRuleKernels *ruleEntry = &ruleKernels[0];
+static LifeRule kernelRule = { LIFE_CONWAY_BIRTH, LIFE_CONWAY_SURVIVAL, 1, LIFE_MOORE, 0, 3, 3, 2, 3 };
+
+// Pick the widest kernel the processor (CPUID) supports, no wider than LIFE_KERNEL asks for
+static int selectKernel()
+{
+	const char *cRequested = getenv("LIFE_KERNEL");
+	int iFirst = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+#endif
+
+	if(cRequested)
+		for(int i = 0; i < LIFE_KERNEL_COUNT; i++)
+			if(strcmp(cRequested, kernelEntries[i].cName) == 0)
+				iFirst = i;
+
+	for(int i = iFirst; i < LIFE_KERNEL_COUNT; i++)
+		if(kernelEntries[i].supported())
+			return i;
+
+	return LIFE_KERNEL_COUNT - 1;
+}
+
+// Kernel chosen once for the whole run
+static int getKernelIndex()
+{
+	static int iKernel = selectKernel();
+	return iKernel;
+}
+
+// Mask of the cells alive next when k is among the neighbour counts uCounts
+static LifeWord countMask(unsigned uCounts, int k)
+{
+	return (uCounts & (1u << k)) ? ~(LifeWord) 0 : 0;
+}
+
+// The masks of nextWordMasks for the rule
+static void setRuleMasks(const LifeRule &rule, LifeWord *uMasks)
+{
+	for(int a = 0; a < 2; a++)
+	{
+		unsigned uCounts = a ? rule.uSurvival : rule.uBirth;
+		for(int k = 0; k < 8; k += 2)
+		{
+			uMasks[8 * a + k] = countMask(uCounts, k);
+			uMasks[8 * a + k + 1] = countMask(uCounts, k) ^ countMask(uCounts, k + 1);
+		}
+	}
+	uMasks[16] = countMask(rule.uBirth, 8);
+	uMasks[17] = countMask(rule.uBirth, 8) ^ countMask(rule.uSurvival, 8);
+}
+
+// Set the rule of all kernels for the whole run (before the first generation)
+void setKernelRule(const LifeRule &rule)
+{
+	kernelRule = rule;
+
+	const int iRules = sizeof(ruleKernels) / sizeof(ruleKernels[0]);
+	ruleEntry = &ruleKernels[iRules - 1];
+	for(int i = 0; i < iRules - 1; i++)
+		if(ruleKernels[i].uBirth == rule.uBirth && ruleKernels[i].uSurvival == rule.uSurvival)
+			ruleEntry = &ruleKernels[i];
+
+	setRuleMasks(rule, uRuleMasks);
+}
+
+// The rule of the run
+const LifeRule &getKernelRule()
+{
+	return kernelRule;
+}
+
+// The rule has kernels of its own
+int isKernelRuleSpecialized()
+{
+	return ruleEntry->uBirth != LIFE_RULE_ANY;
+}
+
+LifeRowKernel getRowKernel()
+{
+	return ruleEntry->rowKernels[getKernelIndex()];
+}
+
+LifeWordKernel getWordKernel()
+{
+	return ruleEntry->wordKernel;
+}
+
+const char *getRowKernelName()
+{
+	return kernelEntries[getKernelIndex()].cName;
+}
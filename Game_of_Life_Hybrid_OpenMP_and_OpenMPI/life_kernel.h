@@ -0,0 +1,166 @@
+/*
+ * The next generation kernel of the bit-packed grid.
+ *
+ * A row is computed by one of the SSE2, AVX2 or AVX-512 kernels (2, 4 or 8 words
+ * per step), whichever the processor supports, or by the scalar kernel otherwise.
+ * Every kernel runs the very same adder network of nextWord, so all of them give
+ * bit-identical results. The environment variable LIFE_KERNEL (scalar, sse2, avx2
+ * or avx512) restricts the choice.
+ *
+ * The rule of the automaton (life_rule.h) is set once for the run. Every well
+ * known rule has kernels of its own, the rule compiled into the adder network;
+ * any other rule runs on kernels reading it from masks once per row, which a
+ * tree of multiplexers over the bits of the neighbour count picks from. The
+ * Larger than Life rules are left to the kernels of life_radius.h.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+#if !defined LIFE_KERNEL_H
+#define LIFE_KERNEL_H
+
+// Including the bit-packed grid and the rules
+#include "life_grid.h"
+#include "life_rule.h"
+
+// Neighbour counts of 64 cells at once (or of one vector of words) as four bits: uOnes, uTwos, uFours and uEights.
+// Every argument holds the word of a row together with its left and right neighbouring words:
+// a* is the row above, b* is the row itself and c* is the row below.
+template<typename Word>
+inline __attribute__((always_inline)) void countNeighbours(const Word &a0, const Word &a1, const Word &a2,
+														   const Word &b0, const Word &b1, const Word &b2,
+														   const Word &c0, const Word &c1, const Word &c2,
+														   Word &uOnes, Word &uTwos, Word &uFours, Word &uEights)
+{
+	// The eight neighbours, each one aligned on the bit of the cell
+	Word uAboveLeft = (a1 << 1) | (a0 >> 63), uAboveRight = (a1 >> 1) | (a2 << 63);
+	Word uLeft = (b1 << 1) | (b0 >> 63), uRight = (b1 >> 1) | (b2 << 63);
+	Word uBelowLeft = (c1 << 1) | (c0 >> 63), uBelowRight = (c1 >> 1) | (c2 << 63);
+
+	// Full adder of the row above: sum and carry
+	Word uAboveSum = uAboveLeft ^ a1 ^ uAboveRight;
+	Word uAboveCarry = (uAboveLeft & a1) | (uAboveRight & (uAboveLeft ^ a1));
+
+	// Half adder of the left and right neighbours
+	Word uMiddleSum = uLeft ^ uRight;
+	Word uMiddleCarry = uLeft & uRight;
+
+	// Full adder of the row below
+	Word uBelowSum = uBelowLeft ^ c1 ^ uBelowRight;
+	Word uBelowCarry = (uBelowLeft & c1) | (uBelowRight & (uBelowLeft ^ c1));
+
+	// Bit 0 of the neighbour count and the carry into bit 1
+	uOnes = uAboveSum ^ uMiddleSum ^ uBelowSum;
+	Word uOnesCarry = (uAboveSum & uMiddleSum) | (uBelowSum & (uAboveSum ^ uMiddleSum));
+
+	// Bits 1, 2 and 3 of the neighbour count
+	Word uTwosPartial = uAboveCarry ^ uMiddleCarry ^ uBelowCarry;
+	Word uTwosCarry = (uAboveCarry & uMiddleCarry) | (uBelowCarry & (uAboveCarry ^ uMiddleCarry));
+	uTwos = uTwosPartial ^ uOnesCarry;
+	uFours = uTwosCarry ^ (uTwosPartial & uOnesCarry);
+	uEights = uTwosCarry & uTwosPartial & uOnesCarry;
+}
+
+// Cells with exactly k live neighbours
+template<typename Word>
+inline __attribute__((always_inline)) Word countEquals(int k, const Word &uOnes, const Word &uTwos, const Word &uFours, const Word &uEights)
+{
+	return ((k & 1) ? uOnes : ~uOnes) & ((k & 2) ? uTwos : ~uTwos) & ((k & 4) ? uFours : ~uFours) & ((k & 8) ? uEights : ~uEights);
+}
+
+// Next state of 64 cells at once under the rule uBirth / uSurvival (see life_rule.h), known at compile time:
+// the neighbour counts of the rule are unrolled into a fixed network, there is no branch or lookup per cell
+template<unsigned uBirth, unsigned uSurvival, typename Word>
+inline __attribute__((always_inline)) Word nextWordRule(const Word &a0, const Word &a1, const Word &a2,
+														const Word &b0, const Word &b1, const Word &b2,
+														const Word &c0, const Word &c1, const Word &c2)
+{
+	Word uOnes, uTwos, uFours, uEights;
+	countNeighbours(a0, a1, a2, b0, b1, b2, c0, c1, c2, uOnes, uTwos, uFours, uEights);
+
+	// The Game of Life: alive with two or three neighbours, or dead with exactly three neighbours
+	if(uBirth == LIFE_CONWAY_BIRTH && uSurvival == LIFE_CONWAY_SURVIVAL)
+		return uTwos & ~uFours & (uOnes | b1);
+
+	Word uAlive = b1 ^ b1;
+	#pragma GCC unroll 9
+	for(int k = 0; k <= 8; k++)
+	{
+		if((uBirth & uSurvival) & (1u << k))
+			uAlive |= countEquals(k, uOnes, uTwos, uFours, uEights);
+		else if(uBirth & (1u << k))
+			uAlive |= countEquals(k, uOnes, uTwos, uFours, uEights) & ~b1;
+		else if(uSurvival & (1u << k))
+			uAlive |= countEquals(k, uOnes, uTwos, uFours, uEights) & b1;
+	}
+	return uAlive;
+}
+
+// Masks of a rule for nextWordMasks: for the dead cells (0) and the live ones (8) the mask of every even neighbour
+// count k (all ones when the cell is alive next) followed by the bits where the mask of k + 1 differs from it, for
+// k = 0, 2, 4 and 6; then the mask of eight neighbours of a dead cell and the bits where the one of a live cell differs
+#define LIFE_RULE_MASKS 18
+
+// Next state of 64 cells at once under any rule, taken from the masks above (setRuleMasks): a tree of multiplexers
+// picks the mask of the neighbour count of every cell, a bit of the count at a time, no branch per cell
+template<typename Word>
+inline __attribute__((always_inline)) Word nextWordMasks(const LifeWord *uMasks,
+														 const Word &a0, const Word &a1, const Word &a2,
+														 const Word &b0, const Word &b1, const Word &b2,
+														 const Word &c0, const Word &c1, const Word &c2)
+{
+	Word uOnes, uTwos, uFours, uEights;
+	countNeighbours(a0, a1, a2, b0, b1, b2, c0, c1, c2, uOnes, uTwos, uFours, uEights);
+
+	// Counts 0 to 7 of the dead cells and of the live ones: uOnes, then uTwos, then uFours picks the half
+	Word uNext[2];
+	for(int a = 0; a < 2; a++)
+	{
+		const LifeWord *uHalf = uMasks + 8 * a;
+		Word u01 = uHalf[0] ^ (uOnes & uHalf[1]);
+		Word u23 = uHalf[2] ^ (uOnes & uHalf[3]);
+		Word u45 = uHalf[4] ^ (uOnes & uHalf[5]);
+		Word u67 = uHalf[6] ^ (uOnes & uHalf[7]);
+		Word u03 = u01 ^ (uTwos & (u01 ^ u23));
+		Word u47 = u45 ^ (uTwos & (u45 ^ u67));
+		uNext[a] = u03 ^ (uFours & (u03 ^ u47));
+	}
+	Word uAlive = uNext[0] ^ (b1 & (uNext[0] ^ uNext[1]));
+
+	// Eight neighbours leave the three lower bits of the count clear, like none
+	Word uEight = uMasks[16] ^ (b1 & uMasks[17]);
+	return uAlive ^ (uEights & (uAlive ^ uEight));
+}
+
+// Next state of 64 cells at once under the Game of Life
+template<typename Word>
+inline __attribute__((always_inline)) Word nextWord(const Word &a0, const Word &a1, const Word &a2,
+												   const Word &b0, const Word &b1, const Word &b2,
+												   const Word &c0, const Word &c1, const Word &c2)
+{
+	return nextWordRule<LIFE_CONWAY_BIRTH, LIFE_CONWAY_SURVIVAL>(a0, a1, a2, b0, b1, b2, c0, c1, c2);
+}
+
+// Kernel computing the iWordCount words of a row; the words at index -1 and
+// iWordCount of the three input rows must be readable (the grid padding)
+typedef void (*LifeRowKernel)(const LifeWord *uAbove, const LifeWord *uRow, const LifeWord *uBelow,
+							  LifeWord *uRowNew, int iWordCount);
+
+// Kernel computing one word (the arguments as for nextWord)
+typedef LifeWord (*LifeWordKernel)(LifeWord a0, LifeWord a1, LifeWord a2, LifeWord b0, LifeWord b1, LifeWord b2,
+								   LifeWord c0, LifeWord c1, LifeWord c2);
+
+// Rule of the kernels which have no kernel of their own, taken from the masks
+#define LIFE_RULE_ANY 0xffffffffu
+
+// Signature of the methods
+void setKernelRule(const LifeRule &rule);
+const LifeRule &getKernelRule();
+int isKernelRuleSpecialized();
+LifeRowKernel getRowKernel();
+LifeWordKernel getWordKernel();
+const char *getRowKernelName();
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * The placement of the threads and of the grids on the NUMA nodes.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.1 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <omp.h>
+#if defined __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+// Including the placement
+#include "life_placement.h"
+
+using namespace std;
+
+// Clear a grid of allocateGridUntouched from within a parallel region, with the team of the caller: every thread first touches
+// the tiles of the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) it computes in nextGenerationScheduled (after
+// applySchedule), the threads share the rest row by row. All threads of the team call it, they wait for each other at the end.
+void placeGridTeam(const LifeSchedule &schedule, LifeGrid &grid, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	int iTileRowCount = (iRowEnd > iRowStart) ? (iRowEnd - iRowStart + schedule.iTileRows - 1) / schedule.iTileRows : 0;
+	int iTileColumnCount = (iWordEnd > iWordStart) ? (iWordEnd - iWordStart + schedule.iTileWords - 1) / schedule.iTileWords : 0;
+
+	// The tiles, shared as nextGenerationScheduled shares them
+	#pragma omp for schedule(runtime) nowait
+	for(int t = 0; t < iTileRowCount * iTileColumnCount; t++)
+	{
+		int iTileRowStart = iRowStart + (t / iTileColumnCount) * schedule.iTileRows;
+		int iTileRowEnd = (iTileRowStart + schedule.iTileRows < iRowEnd) ? iTileRowStart + schedule.iTileRows : iRowEnd;
+		int iTileWordStart = iWordStart + (t % iTileColumnCount) * schedule.iTileWords;
+		int iTileWordEnd = (iTileWordStart + schedule.iTileWords < iWordEnd) ? iTileWordStart + schedule.iTileWords : iWordEnd;
+
+		for(int i = iTileRowStart; i < iTileRowEnd; i++)
+			memset(getRow(grid, i) + iTileWordStart, 0, (iTileWordEnd - iTileWordStart) * sizeof(LifeWord));
+	}
+
+	// The rows around the tiles and the words left and right of them, with the padding
+	#pragma omp for schedule(static) nowait
+	for(int i = 0; i < grid.iRowCount; i++)
+	{
+		LifeWord *uRow = getRow(grid, i);
+		if(iTileRowCount * iTileColumnCount > 0 && i >= iRowStart && i < iRowEnd)
+		{
+			memset(uRow, 0, iWordStart * sizeof(LifeWord));
+			memset(uRow + iWordEnd, 0, (grid.iStride - iWordEnd) * sizeof(LifeWord));
+		}
+		else
+			memset(uRow, 0, grid.iStride * sizeof(LifeWord));
+	}
+
+	// The dead cache line in front of the first row, the team waits for the whole grid
+	#pragma omp single
+	memset(grid.uCells, 0, LIFE_LINE_WORDS * sizeof(LifeWord));
+}
+
+// Clear a grid of allocateGridUntouched with a team of iThreadCount threads of its own, as placeGridTeam does
+void placeGrid(const LifeSchedule &schedule, LifeGrid &grid, int iThreadCount, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	#pragma omp parallel num_threads(iThreadCount)
+	placeGridTeam(schedule, grid, iRowStart, iRowEnd, iWordStart, iWordEnd);
+}
+
+// Name of the binding of the threads (OMP_PROC_BIND)
+static const char *getBindingName(omp_proc_bind_t binding)
+{
+	switch(binding)
+	{
+		case omp_proc_bind_false:
+			return "none";
+		case omp_proc_bind_true:
+			return "true";
+		case omp_proc_bind_close:
+			return "close (compact)";
+		case omp_proc_bind_spread:
+			return "spread (scatter)";
+		default:
+			return "master";
+	}
+}
+
+// Print the binding of the threads, the CPU and NUMA node every thread runs on and the NUMA nodes of the pages of the grid
+void reportPlacement(const LifeGrid &grid, int iRank, int iThreadCount)
+{
+	ostringstream sReport;
+	sReport << "Process " << iRank << " | Binding: " << getBindingName(omp_get_proc_bind()) << " | Places: " << omp_get_num_places() << endl;
+
+	// CPU and NUMA node of every thread
+	int *iCpus = (int *) malloc(2 * iThreadCount * sizeof(int));
+	int *iThreadNodes = iCpus + iThreadCount;
+	#pragma omp parallel num_threads(iThreadCount)
+	{
+		unsigned int uCpu = 0, uNode = 0;
+		int iValid = 0;
+#if defined __linux__ && defined SYS_getcpu
+		iValid = syscall(SYS_getcpu, &uCpu, &uNode, NULL) == 0;
+#endif
+		iCpus[omp_get_thread_num()] = iValid ? (int) uCpu : -1;
+		iThreadNodes[omp_get_thread_num()] = iValid ? (int) uNode : -1;
+	}
+
+	sReport << "Process " << iRank << " | Threads on CPU (NUMA node):";
+	for(int t = 0; t < iThreadCount; t++)
+		sReport << " " << iCpus[t] << " (" << iThreadNodes[t] << ")";
+	sReport << endl;
+	free(iCpus);
+
+	// NUMA nodes of (at most LIFE_PLACEMENT_MAX_PAGES of) the pages of the grid
+	long lPageCounts[LIFE_PLACEMENT_MAX_NODES] = { 0 };
+	long lPagesFound = 0;
+#if defined __linux__ && defined SYS_move_pages
+	size_t iPageSize = (size_t) sysconf(_SC_PAGESIZE);
+	size_t iBytes = (LIFE_LINE_WORDS + (size_t) grid.iRowCount * grid.iStride) * sizeof(LifeWord);
+	uintptr_t uFirstPage = (uintptr_t) grid.uCells & ~(uintptr_t) (iPageSize - 1);
+	size_t iPageCount = ((uintptr_t) grid.uCells + iBytes - uFirstPage + iPageSize - 1) / iPageSize;
+	size_t iSampleCount = (iPageCount < LIFE_PLACEMENT_MAX_PAGES) ? iPageCount : LIFE_PLACEMENT_MAX_PAGES;
+
+	void **pPages = (void **) malloc(iSampleCount * sizeof(void *));
+	int *iStatus = (int *) malloc(iSampleCount * sizeof(int));
+	for(size_t k = 0; k < iSampleCount; k++)
+		pPages[k] = (void *) (uFirstPage + ((k * iPageCount) / iSampleCount) * iPageSize);
+
+	// Without target nodes move_pages moves nothing, it reports the node of every page
+	if(syscall(SYS_move_pages, 0, iSampleCount, pPages, NULL, iStatus, 0) == 0)
+	{
+		for(size_t k = 0; k < iSampleCount; k++)
+			if(iStatus[k] >= 0 && iStatus[k] < LIFE_PLACEMENT_MAX_NODES)
+			{
+				lPageCounts[iStatus[k]]++;
+				lPagesFound++;
+			}
+	}
+	free(pPages);
+	free(iStatus);
+#endif
+
+	sReport << "Process " << iRank << " | Grid pages:";
+	if(lPagesFound == 0)
+		sReport << " unknown";
+	for(int n = 0; n < LIFE_PLACEMENT_MAX_NODES; n++)
+		if(lPageCounts[n])
+			sReport << " node " << n << ": " << (100.0 * lPageCounts[n]) / lPagesFound << "%";
+	sReport << endl;
+
+	cout << sReport.str();
+}
@@ -0,0 +1,39 @@
+/*
+ * The placement of the threads and of the grids on the NUMA nodes.
+ *
+ * A page of memory lands on the NUMA node of the thread touching it first. The
+ * grids are therefore allocated untouched and cleared by the threads tile by
+ * tile, every thread the tiles it computes later on (with the static schedule
+ * the same tiles in every generation), so that the threads read their cells
+ * from the memory of their own socket. placeGridTeam does the same within a
+ * running parallel region, for the grids allocated again when the blocks move.
+ *
+ * The threads are pinned by the OpenMP runtime: OMP_PLACES=cores together with
+ * OMP_PROC_BIND=close packs the threads of a process onto neighbouring cores
+ * (compact), OMP_PROC_BIND=spread spreads them over the sockets (scatter).
+ * reportPlacement shows where the threads and the pages of a grid ended up.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.1 10/18/2026
+ *
+ */
+
+#if !defined LIFE_PLACEMENT_H
+#define LIFE_PLACEMENT_H
+
+// Including the bit-packed grid and the schedule of the threads
+#include "life_grid.h"
+#include "life_schedule.h"
+
+// NUMA nodes told apart by the report
+#define LIFE_PLACEMENT_MAX_NODES 64
+
+// Pages of a grid looked up by the report at most
+#define LIFE_PLACEMENT_MAX_PAGES 4096
+
+// Signature of the methods
+void placeGridTeam(const LifeSchedule &schedule, LifeGrid &grid, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd);
+void placeGrid(const LifeSchedule &schedule, LifeGrid &grid, int iThreadCount, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd);
+void reportPlacement(const LifeGrid &grid, int iRank, int iThreadCount);
+
+#endif
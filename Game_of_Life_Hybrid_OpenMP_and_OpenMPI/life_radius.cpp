@@ -0,0 +1,222 @@
+/*
+ * The kernels of the Larger than Life rules on the bit-packed grid.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the kernels of the Larger than Life rules
+#include "life_radius.h"
+
+// Counts of a strip and of the cells around it
+struct LifeRadiusStrip
+{
+	int iTop, iLeft;		// First row and column of the grid held by the strip
+	int iHeight, iWidth;	// Rows and columns held
+	int *iCells;			// The cells (dead outside of the grid)
+	int *iSums;				// Summed-area table (Moore) or prefix sums along the down-right diagonals (von Neumann)
+	int *iAntiSums;			// Prefix sums along the down-left diagonals (von Neumann)
+	int *iDiamonds;			// Counts of the diamonds of a row (von Neumann)
+};
+
+// Unpack the cells of the rows [iTop, iTop + iHeight) and the columns [iLeft, iLeft + iWidth) of the grid
+static void unpackStrip(LifeRadiusStrip &strip, const LifeGrid &grid)
+{
+	for(int y = 0; y < strip.iHeight; y++)
+	{
+		int i = strip.iTop + y;
+		int *iRow = strip.iCells + (size_t) y * strip.iWidth;
+		if(i < 0 || i >= grid.iRowCount)
+		{
+			memset(iRow, 0, strip.iWidth * sizeof(int));
+			continue;
+		}
+
+		const LifeWord *uRow = getRow(grid, i);
+		for(int x = 0; x < strip.iWidth; x++)
+		{
+			int j = strip.iLeft + x;
+			iRow[x] = (j >= 0 && j < grid.iColumnCount) ? (int) ((uRow[j / LIFE_WORD_BITS] >> (j % LIFE_WORD_BITS)) & 1) : 0;
+		}
+	}
+}
+
+// Summed-area table of the strip: iSums[(y + 1) * (iWidth + 1) + x + 1] counts the cells of the rows 0 .. y and the columns 0 .. x
+static void sumStrip(LifeRadiusStrip &strip)
+{
+	int iStride = strip.iWidth + 1;
+	memset(strip.iSums, 0, iStride * sizeof(int));
+
+	for(int y = 0; y < strip.iHeight; y++)
+	{
+		const int *iRow = strip.iCells + (size_t) y * strip.iWidth;
+		int *iSum = strip.iSums + (size_t) (y + 1) * iStride;
+		int iRowSum = 0;
+
+		iSum[0] = 0;
+		for(int x = 0; x < strip.iWidth; x++)
+		{
+			iRowSum += iRow[x];
+			iSum[x + 1] = iSum[x + 1 - iStride] + iRowSum;
+		}
+	}
+}
+
+// Prefix sums of the strip along both diagonals: iSums from the upper left, iAntiSums from the upper right
+static void sumStripDiagonals(LifeRadiusStrip &strip)
+{
+	int w = strip.iWidth;
+	for(int y = 0; y < strip.iHeight; y++)
+	{
+		const int *iRow = strip.iCells + (size_t) y * w;
+		int *iSum = strip.iSums + (size_t) y * w, *iAntiSum = strip.iAntiSums + (size_t) y * w;
+
+		for(int x = 0; x < w; x++)
+		{
+			iSum[x] = iRow[x] + ((y > 0 && x > 0) ? iSum[x - 1 - w] : 0);
+			iAntiSum[x] = iRow[x] + ((y > 0 && x < w - 1) ? iAntiSum[x + 1 - w] : 0);
+		}
+	}
+}
+
+// Next state of a cell with iCount live cells in its neighbourhood (the cell itself included)
+static inline LifeWord nextCell(const LifeRule &rule, int iAlive, int iCount)
+{
+	if(!rule.iMiddle)
+		iCount -= iAlive;
+
+	if(iAlive)
+		return (unsigned) (iCount - rule.iSurvivalMin) <= (unsigned) (rule.iSurvivalMax - rule.iSurvivalMin);
+	return (unsigned) (iCount - rule.iBirthMin) <= (unsigned) (rule.iBirthMax - rule.iBirthMin);
+}
+
+// Compute the rows [iRowStart, iRowEnd) and the columns [iColumnStart, iColumnEnd) of the strip, whose words
+// [iWordStart, iWordEnd) are written as a whole. Only the cells between the left and right layer come alive.
+static void nextGenerationStrip(LifeRadiusStrip &strip, const LifeRule &rule, const LifeGrid &grid, LifeGrid &gridNew,
+								int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	int r = rule.iRadius;
+	int iColumnStart = iWordStart * LIFE_WORD_BITS;
+	int iColumnEnd = (iWordEnd * LIFE_WORD_BITS < grid.iColumnCount) ? iWordEnd * LIFE_WORD_BITS : grid.iColumnCount;
+
+	// The strip holds r + 1 rows and columns around the cells (r + 2 columns on the right): the prefix sums
+	// start one row and column before the neighbourhoods of the first row and column
+	strip.iTop = iRowStart - r - 1;
+	strip.iLeft = iColumnStart - r - 1;
+	strip.iHeight = iRowEnd - iRowStart + 2 * r + 1;
+	strip.iWidth = iColumnEnd - iColumnStart + 2 * r + 2;
+	unpackStrip(strip, grid);
+
+	int w = strip.iWidth;
+	if(rule.neighbourhood == LIFE_MOORE)
+		sumStrip(strip);
+	else
+	{
+		sumStripDiagonals(strip);
+
+		// The diamond of the first cell, cell by cell
+		int y0 = r + 1, x0 = r + 1, iCount = 0;
+		for(int dy = -r; dy <= r; dy++)
+		{
+			int iReach = r - abs(dy);
+			for(int dx = -iReach; dx <= iReach; dx++)
+				iCount += strip.iCells[(size_t) (y0 + dy) * w + x0 + dx];
+		}
+
+		// The diamonds of the first row, each one from the one on its left: its right edges come in, the left edges
+		// of the former one go. An edge of n cells along a diagonal is the difference of two prefix sums.
+		const int *P = strip.iSums, *A = strip.iAntiSums;
+		strip.iDiamonds[0] = iCount;
+		for(int x = x0 + 1; x < x0 + iColumnEnd - iColumnStart; x++)
+		{
+			iCount += P[y0 * w + x + r] - P[(y0 - r - 1) * w + x - 1];
+			iCount += A[(y0 + r) * w + x] - A[y0 * w + x + r];
+			iCount -= A[y0 * w + x - 1 - r] - A[(y0 - r - 1) * w + x];
+			iCount -= P[(y0 + r) * w + x - 1] - P[y0 * w + x - r - 1];
+			strip.iDiamonds[x - x0] = iCount;
+		}
+	}
+
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		int y = i - strip.iTop;
+		const int *iRow = strip.iCells + (size_t) y * w;
+		LifeWord *uRowNew = getRow(gridNew, i);
+
+		// The diamonds of the row, each one from the one above it: its bottom edges come in, the top edges
+		// of the former one go
+		if(rule.neighbourhood == LIFE_VON_NEUMANN && i > iRowStart)
+		{
+			const int *P = strip.iSums, *A = strip.iAntiSums;
+			for(int x = r + 1; x < r + 1 + iColumnEnd - iColumnStart; x++)
+			{
+				int iCount = strip.iDiamonds[x - r - 1];
+				iCount += P[(y + r) * w + x] - P[(y - 1) * w + x - r - 1];
+				iCount += A[(y + r - 1) * w + x + 1] - A[(y - 1) * w + x + r + 1];
+				iCount -= A[(y - 1) * w + x - r] - A[(y - r - 2) * w + x + 1];
+				iCount -= P[(y - 1) * w + x + r] - P[(y - r - 1) * w + x];
+				strip.iDiamonds[x - r - 1] = iCount;
+			}
+		}
+
+		for(int iWord = iWordStart; iWord < iWordEnd; iWord++)
+		{
+			int iFirst = iWord * LIFE_WORD_BITS, iLast = iFirst + LIFE_WORD_BITS;
+			if(iFirst < 1)
+				iFirst = 1;
+			if(iLast > grid.iColumnCount - 1)
+				iLast = grid.iColumnCount - 1;
+
+			LifeWord uWord = 0;
+			for(int j = iFirst; j < iLast; j++)
+			{
+				int x = j - strip.iLeft, iCount;
+				if(rule.neighbourhood == LIFE_MOORE)
+				{
+					// The square of the rows y - r .. y + r and the columns x - r .. x + r
+					const int *iAbove = strip.iSums + (size_t) (y - r) * (w + 1);
+					const int *iBelow = strip.iSums + (size_t) (y + r + 1) * (w + 1);
+					iCount = iBelow[x + r + 1] - iBelow[x - r] - iAbove[x + r + 1] + iAbove[x - r];
+				}
+				else
+					iCount = strip.iDiamonds[x - r - 1];
+
+				uWord |= nextCell(rule, iRow[x], iCount) << (j % LIFE_WORD_BITS);
+			}
+			uRowNew[iWord] = uWord;
+		}
+	}
+}
+
+// Compute the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) of the next generation into gridNew, strip by strip
+void nextGenerationRadius(const LifeRule &rule, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	if(iRowStart >= iRowEnd || iWordStart >= iWordEnd)
+		return;
+
+	// Buffers for the largest strip
+	int r = rule.iRadius;
+	size_t iHeight = LIFE_RADIUS_STRIP_ROWS + 2 * r + 1, iWidth = LIFE_RADIUS_STRIP_WORDS * LIFE_WORD_BITS + 2 * r + 2;
+	LifeRadiusStrip strip;
+	strip.iCells = (int *) malloc(iHeight * iWidth * sizeof(int));
+	strip.iSums = (int *) malloc((iHeight + 1) * (iWidth + 1) * sizeof(int));
+	strip.iAntiSums = (int *) malloc(iHeight * iWidth * sizeof(int));
+	strip.iDiamonds = (int *) malloc(iWidth * sizeof(int));
+
+	for(int i = iRowStart; i < iRowEnd; i += LIFE_RADIUS_STRIP_ROWS)
+	{
+		int iStripEnd = (i + LIFE_RADIUS_STRIP_ROWS < iRowEnd) ? i + LIFE_RADIUS_STRIP_ROWS : iRowEnd;
+		for(int w = iWordStart; w < iWordEnd; w += LIFE_RADIUS_STRIP_WORDS)
+			nextGenerationStrip(strip, rule, grid, gridNew, i, iStripEnd, w, (w + LIFE_RADIUS_STRIP_WORDS < iWordEnd) ? w + LIFE_RADIUS_STRIP_WORDS : iWordEnd);
+	}
+
+	free(strip.iCells);
+	free(strip.iSums);
+	free(strip.iAntiSums);
+	free(strip.iDiamonds);
+}
@@ -0,0 +1,36 @@
+/*
+ * The kernels of the Larger than Life rules on the bit-packed grid.
+ *
+ * Counting the (2r + 1) * (2r + 1) cells around every cell one by one would cost
+ * 441 additions per cell at radius 10. The cells are counted in strips of
+ * LIFE_RADIUS_STRIP_ROWS rows by LIFE_RADIUS_STRIP_WORDS words instead: the
+ * strip with the r rows and columns around it is unpacked into a summed-area
+ * table, which gives the count of any square in four lookups (Moore). The
+ * diamond of the von Neumann neighbourhood is counted from prefix sums along
+ * both diagonals: moving the diamond by one cell adds and removes four diagonal
+ * edges of it, two lookups each. Either way a cell costs the same at any radius.
+ *
+ * The cells within r rows or columns of the edge of the grid count the cells
+ * outside of it as dead: the grid needs outer layers (or halos) of r rows and
+ * columns.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#if !defined LIFE_RADIUS_H
+#define LIFE_RADIUS_H
+
+// Including the bit-packed grid and the rules
+#include "life_grid.h"
+#include "life_rule.h"
+
+// Rows and words of a strip
+#define LIFE_RADIUS_STRIP_ROWS 64
+#define LIFE_RADIUS_STRIP_WORDS 8
+
+// Signature of the methods
+void nextGenerationRadius(const LifeRule &rule, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd);
+
+#endif
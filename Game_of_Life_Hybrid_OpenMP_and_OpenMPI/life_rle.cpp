@@ -0,0 +1,457 @@
+/*
+ * The RLE pattern file of the Game of Life.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+// Including the RLE pattern file
+#include "life_rle.h"
+
+using namespace std;
+
+// Longest line of the header and the comments kept (the rest of a longer one is skipped)
+#define LIFE_RLE_HEADER_SIZE 1024
+
+// The block of the pattern read into a grid
+struct LifeRlePlacement
+{
+	LifeGrid *pGrid;
+	int iToRow, iToColumn;			// Cell of the grid of the first cell of the block
+	int iFromRow, iRowSize;			// Rows of the pattern of the block
+	int iFromColumn, iColumnSize;	// Columns of the pattern of the block
+};
+
+// The lines of runs being written
+struct LifeRleWriter
+{
+	FILE *pFile;
+	int iLineLength;				// Characters of the line so far
+	long long lEmptyRows;			// Rows ended but not written yet ('$')
+};
+
+// Read a line of the file into sLine (without its end). Returns 0 at the end of the file.
+static int readLine(FILE *pFile, char *sLine, int iSize)
+{
+	if(!fgets(sLine, iSize, pFile))
+		return 0;
+
+	size_t iLength = strlen(sLine);
+	if(iLength > 0 && sLine[iLength - 1] == '\n')
+		sLine[--iLength] = '\0';
+	else
+	{
+		int c;
+		while((c = fgetc(pFile)) != EOF && c != '\n')
+			;
+	}
+	if(iLength > 0 && sLine[iLength - 1] == '\r')
+		sLine[iLength - 1] = '\0';
+	return 1;
+}
+
+// The text behind leading blanks
+static char *skipBlanks(char *sText)
+{
+	while(isspace((unsigned char) *sText))
+		sText++;
+	return sText;
+}
+
+// Whether the first line which is no comment starts with the "x" of the header
+int isRleFile(const char *sFileName)
+{
+	FILE *pFile = fopen(sFileName, "r");
+	if(!pFile)
+		return 0;
+
+	char sLine[LIFE_RLE_HEADER_SIZE];
+	int iRle = 0;
+	while(readLine(pFile, sLine, sizeof(sLine)))
+	{
+		char *sText = skipBlanks(sLine);
+		if(*sText == '#' || *sText == '\0')
+			continue;
+		iRle = *sText == 'x' && (sText[1] == '=' || isspace((unsigned char) sText[1]));
+		break;
+	}
+
+	fclose(pFile);
+	return iRle;
+}
+
+// Whether the name of the output ends in ".rle"
+int isRleOutput(const char *sFileName)
+{
+	size_t iLength = strlen(sFileName);
+	return iLength >= 4 && strcmp(sFileName + iLength - 4, ".rle") == 0;
+}
+
+// Read the header "x = <columns>, y = <rows>[, rule = <rule>]". The rule goes last: a Larger than
+// Life rule holds commas of its own. Returns 0 if the line is no header.
+static int parseHeader(LifeRle &rle, char *sLine)
+{
+	char *sRule = strstr(sLine, "rule");
+	if(sRule)
+	{
+		*sRule = '\0';
+		sRule = skipBlanks(sRule + 4);
+		if(*sRule != '=')
+			return 0;
+		sRule = skipBlanks(sRule + 1);
+
+		// Blanks at the end and the topology of Golly (":T<width>,<height>") are no part of the rule
+		size_t iLength = strcspn(sRule, ":");
+		while(iLength > 0 && isspace((unsigned char) sRule[iLength - 1]))
+			iLength--;
+		if(iLength == 0 || iLength >= sizeof(rle.sRule))
+			return 0;
+		memcpy(rle.sRule, sRule, iLength);
+		rle.sRule[iLength] = '\0';
+	}
+
+	int iSeen = 0;
+	for(char *sField = strtok(sLine, ","); sField; sField = strtok(NULL, ","))
+	{
+		sField = skipBlanks(sField);
+		if(*sField == '\0')
+			continue;
+
+		char cKey = *sField;
+		char *sValue = skipBlanks(sField + 1), *sEnd;
+		if((cKey != 'x' && cKey != 'y') || *sValue != '=')
+			return 0;
+		long lValue = strtol(sValue + 1, &sEnd, 10);
+		if(*skipBlanks(sEnd) != '\0' || lValue < 1 || lValue > INT_MAX - 2 * LIFE_WORD_BITS)
+			return 0;
+
+		if(cKey == 'x')
+			rle.iColumnCount = (int) lValue;
+		else
+			rle.iRowCount = (int) lValue;
+		iSeen |= (cKey == 'x') ? 1 : 2;
+	}
+	return iSeen == 3;
+}
+
+// Read the comments and the header of the file. Returns 0 (with a message) when the file is unusable.
+int openRle(LifeRle &rle, const char *sFileName)
+{
+	rle.pFile = fopen(sFileName, "r");
+	rle.sRule[0] = '\0';
+	rle.lRowOrigin = rle.lColumnOrigin = 0;
+	rle.uGeneration = 0;
+	if(!rle.pFile)
+	{
+		cerr << "Unable to open " << sFileName << endl;
+		return 0;
+	}
+
+	char sLine[LIFE_RLE_HEADER_SIZE];
+	while(readLine(rle.pFile, sLine, sizeof(sLine)))
+	{
+		char *sText = skipBlanks(sLine);
+		if(*sText == '\0')
+			continue;
+
+		// The place and the generation of the pattern
+		if(strncmp(sText, "#CXRLE", 6) == 0)
+		{
+			char *sPos = strstr(sText, "Pos="), *sGen = strstr(sText, "Gen=");
+			if(sPos)
+				sscanf(sPos + 4, "%lld,%lld", &rle.lColumnOrigin, &rle.lRowOrigin);
+			if(sGen)
+				rle.uGeneration = strtoull(sGen + 4, NULL, 10);
+			continue;
+		}
+		if(*sText == '#')
+			continue;
+
+		if(!parseHeader(rle, sText))
+			break;
+		rle.lDataOffset = ftell(rle.pFile);
+		return 1;
+	}
+
+	cerr << sFileName << " has no header of an RLE pattern" << endl;
+	closeRle(rle);
+	return 0;
+}
+
+// Close the file
+void closeRle(LifeRle &rle)
+{
+	if(rle.pFile)
+		fclose(rle.pFile);
+	rle.pFile = NULL;
+}
+
+// Go through the runs of the file, handing every run of live cells within the pattern to visitRun. Dead cells
+// and rows are only counted. Returns 0 if the runs hold anything but counts, tags and blanks.
+int scanRuns(LifeRle &rle, LifeRunVisitor visitRun, void *pState)
+{
+	if(fseek(rle.pFile, rle.lDataOffset, SEEK_SET) != 0)
+		return 0;
+
+	char *cBuffer = (char *) malloc(LIFE_RLE_BUFFER_SIZE);
+	long long lCount = 0, lRow = 0, lColumn = 0;
+	int iDone = 0, iBroken = 0;
+	size_t iRead;
+
+	while(!iDone && !iBroken && (iRead = fread(cBuffer, 1, LIFE_RLE_BUFFER_SIZE, rle.pFile)) > 0)
+		for(size_t k = 0; k < iRead && !iDone && !iBroken; k++)
+		{
+			char c = cBuffer[k];
+			if(c >= '0' && c <= '9')
+			{
+				lCount = lCount * 10 + (c - '0');
+				iBroken = lCount > INT_MAX;
+				continue;
+			}
+			if(isspace((unsigned char) c))
+				continue;
+
+			long long n = lCount ? lCount : 1;
+			lCount = 0;
+			if(c == '!')
+				iDone = 1;
+			else if(c == '$')
+			{
+				lRow += n;
+				lColumn = 0;
+			}
+			else if(c == 'b' || c == '.')
+				lColumn += n;
+			else if(isalpha((unsigned char) c))
+			{
+				// 'o', or a live state of a pattern of more states
+				if(lRow < rle.iRowCount && lColumn < rle.iColumnCount)
+					visitRun(pState, (int) lRow, (int) lColumn, (int) ((n < rle.iColumnCount - lColumn) ? n : rle.iColumnCount - lColumn));
+				lColumn += n;
+			}
+			else
+				iBroken = 1;
+		}
+
+	free(cBuffer);
+	return !iBroken;
+}
+
+// Bring the cells of a run within the block to life
+static void placeRun(void *pState, int iRow, int iColumn, int iCount)
+{
+	LifeRlePlacement &placement = *(LifeRlePlacement *) pState;
+	if(iRow < placement.iFromRow || iRow >= placement.iFromRow + placement.iRowSize)
+		return;
+
+	int iStart = (iColumn > placement.iFromColumn) ? iColumn : placement.iFromColumn;
+	int iEnd = (iColumn + iCount < placement.iFromColumn + placement.iColumnSize) ? iColumn + iCount : placement.iFromColumn + placement.iColumnSize;
+	if(iStart < iEnd)
+		setBits(getRow(*placement.pGrid, placement.iToRow + iRow - placement.iFromRow), placement.iToColumn + iStart - placement.iFromColumn, iEnd - iStart);
+}
+
+// Bring the live cells of iRowSize * iColumnSize cells of the pattern (from row iFromRow and column iFromColumn,
+// counting from 0) to life in the grid at row iToRow and column iToColumn; the other cells of the grid stay as they are.
+// Returns 0 (with a message) when the runs are broken.
+int readRleCells(LifeRle &rle, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize)
+{
+	LifeRlePlacement placement = { &grid, iToRow, iToColumn, iFromRow, iRowSize, iFromColumn, iColumnSize };
+	if(scanRuns(rle, placeRun, &placement))
+		return 1;
+
+	cerr << "The runs of the RLE pattern are broken" << endl;
+	return 0;
+}
+
+// Grow the bounding box by a run
+static void boundRun(void *pState, int iRow, int iColumn, int iCount)
+{
+	int *iBounds = (int *) pState;
+	if(iRow < iBounds[0])
+		iBounds[0] = iRow;
+	iBounds[1] = iRow + 1;
+	if(iColumn < iBounds[2])
+		iBounds[2] = iColumn;
+	if(iColumn + iCount > iBounds[3])
+		iBounds[3] = iColumn + iCount;
+}
+
+// Bounding box of the live cells of the pattern: the rows [iBounds[0], iBounds[1]) and the columns [iBounds[2], iBounds[3]).
+// Returns 0 when no cell is alive or the runs are broken.
+int findRleBounds(LifeRle &rle, int iBounds[4])
+{
+	iBounds[0] = iBounds[2] = INT_MAX;
+	iBounds[1] = iBounds[3] = -1;
+	return scanRuns(rle, boundRun, iBounds) && iBounds[1] >= 0;
+}
+
+// First cell from iFrom on (before iEnd) which is alive (iAlive) or dead. Returns iEnd if there is none.
+static int findCell(const LifeWord *uRow, int iFrom, int iEnd, int iAlive)
+{
+	while(iFrom < iEnd)
+	{
+		LifeWord uWord = iAlive ? uRow[iFrom / LIFE_WORD_BITS] : ~uRow[iFrom / LIFE_WORD_BITS];
+		uWord >>= iFrom % LIFE_WORD_BITS;
+		if(uWord)
+		{
+			int iCell = iFrom + __builtin_ctzll(uWord);
+			return (iCell < iEnd) ? iCell : iEnd;
+		}
+		iFrom = (iFrom / LIFE_WORD_BITS + 1) * LIFE_WORD_BITS;
+	}
+	return iEnd;
+}
+
+// Write a run of lCount cells (or rows) with the tag cTag, on a new line if it does not fit on the one so far
+static void writeRun(LifeRleWriter &writer, long long lCount, char cTag)
+{
+	char sRun[32];
+	int iLength = (lCount > 1) ? snprintf(sRun, sizeof(sRun), "%lld%c", lCount, cTag) : snprintf(sRun, sizeof(sRun), "%c", cTag);
+	if(writer.iLineLength + iLength > LIFE_RLE_LINE_LENGTH)
+	{
+		fputc('\n', writer.pFile);
+		writer.iLineLength = 0;
+	}
+	fputs(sRun, writer.pFile);
+	writer.iLineLength += iLength;
+}
+
+// Create the file and write the place, the generation and the header of the pattern. Returns 0 if the file cannot be created.
+static int beginRle(LifeRleWriter &writer, const char *sFileName, int iRowCount, int iColumnCount, const LifeRule &rule,
+					uint64_t uGeneration, long long lRowOrigin, long long lColumnOrigin)
+{
+	writer.pFile = fopen(sFileName, "w");
+	writer.iLineLength = 0;
+	writer.lEmptyRows = 0;
+	if(!writer.pFile)
+		return 0;
+
+	char sRule[LIFE_RULE_NAME_SIZE];
+	formatRule(rule, sRule);
+	fprintf(writer.pFile, "#CXRLE Pos=%lld,%lld Gen=%llu\n", lColumnOrigin, lRowOrigin, (unsigned long long) uGeneration);
+	fprintf(writer.pFile, "x = %d, y = %d, rule = %s\n", iColumnCount, iRowCount, sRule);
+	return 1;
+}
+
+// Write the runs of the cells [iFirst, iEnd) of a row, the live cells found a word at a time. The end of the row
+// is written with the next row holding a live cell: empty rows become the count of a single '$'.
+static void writeRleRow(LifeRleWriter &writer, const LifeWord *uRow, int iFirst, int iEnd)
+{
+	int iAlive = findCell(uRow, iFirst, iEnd, 1);
+	if(iAlive < iEnd && writer.lEmptyRows > 0)
+	{
+		writeRun(writer, writer.lEmptyRows, '$');
+		writer.lEmptyRows = 0;
+	}
+
+	for(int iDead = iFirst; iAlive < iEnd; )
+	{
+		if(iAlive > iDead)
+			writeRun(writer, iAlive - iDead, 'b');
+		iDead = findCell(uRow, iAlive, iEnd, 0);
+		writeRun(writer, iDead - iAlive, 'o');
+		iAlive = findCell(uRow, iDead, iEnd, 1);
+	}
+	writer.lEmptyRows++;
+}
+
+// End the pattern and close the file. Returns 0 if a write failed.
+static int endRle(LifeRleWriter &writer)
+{
+	writeRun(writer, 1, '!');
+	fputc('\n', writer.pFile);
+	int iWritten = !ferror(writer.pFile);
+	return (fclose(writer.pFile) == 0) && iWritten;
+}
+
+// Write the cells within the outer layers of iDepth rows and columns of the grid as an RLE pattern of the rule,
+// placed at row lRowOrigin and column lColumnOrigin of the plane. Returns 0 if the file cannot be written.
+int writeRleFile(const char *sFileName, const LifeGrid &grid, int iDepth, const LifeRule &rule, uint64_t uGeneration,
+				 long long lRowOrigin, long long lColumnOrigin)
+{
+	LifeRleWriter writer;
+	if(!beginRle(writer, sFileName, grid.iRowCount - 2 * iDepth, grid.iColumnCount - 2 * iDepth, rule, uGeneration, lRowOrigin, lColumnOrigin))
+		return 0;
+
+	for(int i = iDepth; i < grid.iRowCount - iDepth; i++)
+		writeRleRow(writer, getRow(grid, i), iDepth, grid.iColumnCount - iDepth);
+	return endRle(writer);
+}
+
+// The runs of live cells of the rows [iRowStart, iRowStart + iRowSize) and the columns [iColumnStart, iColumnStart + iColumnSize)
+// of the grid, as rows and columns counted from iRowOffset and iColumnOffset. Returns the number of runs; the caller frees them.
+long findRuns(const LifeGrid &grid, int iRowStart, int iRowSize, int iColumnStart, int iColumnSize, int iRowOffset, int iColumnOffset, LifeRun *&runs)
+{
+	long lRunCount = 0, lAllocated = 64;
+	runs = (LifeRun *) malloc(lAllocated * sizeof(LifeRun));
+
+	int iEnd = iColumnStart + iColumnSize;
+	for(int i = iRowStart; i < iRowStart + iRowSize; i++)
+	{
+		const LifeWord *uRow = getRow(grid, i);
+		for(int iAlive = findCell(uRow, iColumnStart, iEnd, 1); iAlive < iEnd; )
+		{
+			int iDead = findCell(uRow, iAlive, iEnd, 0);
+			if(lRunCount == lAllocated)
+			{
+				lAllocated *= 2;
+				runs = (LifeRun *) realloc(runs, lAllocated * sizeof(LifeRun));
+			}
+			runs[lRunCount].iRow = i - iRowStart + iRowOffset;
+			runs[lRunCount].iColumn = iAlive - iColumnStart + iColumnOffset;
+			runs[lRunCount].iCount = iDead - iAlive;
+			lRunCount++;
+			iAlive = findCell(uRow, iDead, iEnd, 1);
+		}
+	}
+	return lRunCount;
+}
+
+// Order of the runs: by row, then by column
+static int compareRuns(const void *pFirst, const void *pSecond)
+{
+	const LifeRun *first = (const LifeRun *) pFirst, *second = (const LifeRun *) pSecond;
+	if(first->iRow != second->iRow)
+		return (first->iRow < second->iRow) ? -1 : 1;
+	return (first->iColumn < second->iColumn) ? -1 : (first->iColumn > second->iColumn);
+}
+
+// Write runs of live cells of a grid of iRowCount * iColumnCount cells as an RLE pattern of the rule, its first cell the cell
+// (lRowOrigin, lColumnOrigin) of the plane. The runs are sorted first, runs which meet (at the edges of two blocks) become one.
+// Returns 0 if the file cannot be written.
+int writeRleRuns(const char *sFileName, LifeRun *runs, long lRunCount, int iRowCount, int iColumnCount, const LifeRule &rule, uint64_t uGeneration,
+				 long long lRowOrigin, long long lColumnOrigin)
+{
+	LifeRleWriter writer;
+	if(!beginRle(writer, sFileName, iRowCount, iColumnCount, rule, uGeneration, lRowOrigin, lColumnOrigin))
+		return 0;
+
+	qsort(runs, lRunCount, sizeof(LifeRun), compareRuns);
+	int iRow = 0, iColumn = 0;
+	for(long r = 0; r < lRunCount; )
+	{
+		int iRunRow = runs[r].iRow, iStart = runs[r].iColumn, iEnd = iStart + runs[r].iCount;
+		for(r++; r < lRunCount && runs[r].iRow == iRunRow && runs[r].iColumn == iEnd; r++)
+			iEnd += runs[r].iCount;
+
+		if(iRunRow > iRow)
+		{
+			writeRun(writer, iRunRow - iRow, '$');
+			iRow = iRunRow;
+			iColumn = 0;
+		}
+		if(iStart > iColumn)
+			writeRun(writer, iStart - iColumn, 'b');
+		writeRun(writer, iEnd - iStart, 'o');
+		iColumn = iEnd;
+	}
+	return endRle(writer);
+}
@@ -0,0 +1,86 @@
+/*
+ * The RLE pattern file of the Game of Life, as kept by the pattern libraries.
+ *
+ * After comment lines starting with '#' the header gives the dimension of the
+ * pattern and, optionally, its rule:
+ *
+ *		x = <columns>, y = <rows>, rule = B3/S23
+ *
+ * The rows follow as runs of cells: a count (1 if left out) and a tag, 'b'
+ * for dead cells and 'o' for live ones, '$' ends a row (a count skips empty
+ * rows) and '!' ends the pattern. Dead cells at the end of a row and rows at
+ * the end of the pattern are left out. A comment line
+ *
+ *		#CXRLE Pos=<column>,<row> Gen=<generation>
+ *
+ * gives the place of the pattern on the plane and its generation.
+ *
+ * The runs are read straight from the file into the bit-packed grid, a run of
+ * live cells at a time: only the cells of the block asked for are kept and no
+ * dense copy of the pattern is made, so a few live cells of a huge world are
+ * read in a moment. scanRuns hands the runs to a visitor of the caller, which
+ * keeps them as it likes (the quadtree of HashLife). The writer looks for the
+ * runs a word at a time; the runs of the blocks of several processes are
+ * gathered as runs as well, and sorted and joined before they are written.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/18/2026
+ *
+ */
+
+#if !defined LIFE_RLE_H
+#define LIFE_RLE_H
+
+// Including libraries
+#include <cstdio>
+#include <stdint.h>
+
+// Including the bit-packed grid and the rules
+#include "life_grid.h"
+#include "life_rule.h"
+
+// Longest line of the runs written
+#define LIFE_RLE_LINE_LENGTH 70
+
+// Bytes read from the file at once
+#define LIFE_RLE_BUFFER_SIZE 65536
+
+// An RLE pattern file being read
+struct LifeRle
+{
+	FILE *pFile;
+	long lDataOffset;					// Offset of the runs behind the header
+	int iRowCount;						// Rows of the pattern (y)
+	int iColumnCount;					// Columns of the pattern (x)
+	char sRule[LIFE_RULE_NAME_SIZE];	// Rule of the header (empty if none is given)
+	long long lRowOrigin;				// Row of the plane of the first row (#CXRLE Pos)
+	long long lColumnOrigin;			// Column of the plane of the first column
+	uint64_t uGeneration;				// Generation of the pattern (#CXRLE Gen)
+};
+
+// A run of live cells of a row
+struct LifeRun
+{
+	int iRow;
+	int iColumn;
+	int iCount;
+};
+
+// A run of iCount live cells of the pattern, from row iRow and column iColumn
+typedef void (*LifeRunVisitor)(void *pState, int iRow, int iColumn, int iCount);
+
+// Signature of the methods
+int isRleFile(const char *sFileName);
+int isRleOutput(const char *sFileName);
+int openRle(LifeRle &rle, const char *sFileName);
+void closeRle(LifeRle &rle);
+int scanRuns(LifeRle &rle, LifeRunVisitor visitRun, void *pState);
+int readRleCells(LifeRle &rle, LifeGrid &grid, int iToRow, int iToColumn, int iFromRow, int iRowSize, int iFromColumn, int iColumnSize);
+int findRleBounds(LifeRle &rle, int iBounds[4]);
+int writeRleFile(const char *sFileName, const LifeGrid &grid, int iDepth, const LifeRule &rule, uint64_t uGeneration,
+				 long long lRowOrigin, long long lColumnOrigin);
+long findRuns(const LifeGrid &grid, int iRowStart, int iRowSize, int iColumnStart, int iColumnSize, int iRowOffset, int iColumnOffset, LifeRun *&runs);
+int writeRleRuns(const char *sFileName, LifeRun *runs, long lRunCount, int iRowCount, int iColumnCount, const LifeRule &rule, uint64_t uGeneration,
+				 long long lRowOrigin, long long lColumnOrigin);
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ * The rules of the Life-like cellular automata.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.1 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Including the rules
+#include "life_rule.h"
+
+// Rules known by their name
+struct LifeNamedRule
+{
+	const char *cName;
+	const char *cRule;
+};
+
+static const LifeNamedRule namedRules[] =
+{
+	{ "conway", "B3/S23" },
+	{ "life", "B3/S23" },
+	{ "highlife", "B36/S23" },
+	{ "daynight", "B3678/S34678" },
+	{ "seeds", "B2/S" },
+	{ "lifewithoutdeath", "B3/S012345678" },
+	{ "maze", "B3/S12345" },
+	{ "replicator", "B1357/S1357" },
+	{ "2x2", "B36/S125" },
+	{ "34life", "B34/S34" },
+	{ "morley", "B368/S245" },
+	{ "anneal", "B4678/S35678" },
+	{ "bosco", "R5,C0,M1,S34..58,B34..45,NM" },
+	{ "majority", "R4,C0,M1,S41..81,B41..81,NM" },
+	{ "bugsmovie", "R10,C0,M1,S123..212,B123..170,NM" }
+};
+
+// The Game of Life
+void createRule(LifeRule &rule)
+{
+	rule.uBirth = LIFE_CONWAY_BIRTH;
+	rule.uSurvival = LIFE_CONWAY_SURVIVAL;
+	rule.iRadius = 1;
+	rule.neighbourhood = LIFE_MOORE;
+	rule.iMiddle = 0;
+	rule.iBirthMin = rule.iBirthMax = 3;
+	rule.iSurvivalMin = 2;
+	rule.iSurvivalMax = 3;
+}
+
+// The rule counts more than the eight neighbours (or other ones): it needs the kernels of life_radius.h
+int isLargerThanLife(const LifeRule &rule)
+{
+	return rule.iRadius > 1 || rule.neighbourhood != LIFE_MOORE;
+}
+
+// Cells of the neighbourhood of the rule, the cell itself included
+static int neighbourhoodSize(const LifeRule &rule)
+{
+	int r = rule.iRadius;
+	return (rule.neighbourhood == LIFE_MOORE) ? (2 * r + 1) * (2 * r + 1) : 2 * r * (r + 1) + 1;
+}
+
+// Read a number up to the end of the digits into iValue. Returns the end of the digits or NULL.
+static const char *parseNumber(const char *sDigits, int &iValue)
+{
+	if(!isdigit((unsigned char) *sDigits))
+		return NULL;
+
+	char *sEnd;
+	long lValue = strtol(sDigits, &sEnd, 10);
+	if(lValue > 1000000)
+		return NULL;
+	iValue = (int) lValue;
+	return sEnd;
+}
+
+// Read a range "<min>..<max>" (or a single count) up to the end of the field. Returns 0 if it is none.
+static int parseRange(const char *sRange, int &iMin, int &iMax)
+{
+	const char *sEnd = parseNumber(sRange, iMin);
+	if(!sEnd)
+		return 0;
+
+	iMax = iMin;
+	if(strncmp(sEnd, "..", 2) == 0)
+		sEnd = parseNumber(sEnd + 2, iMax);
+	return sEnd && (*sEnd == ',' || *sEnd == '\0') && iMin <= iMax;
+}
+
+// Read a Larger than Life rule given as R<r>,C<c>,M<m>,S<min>..<max>,B<min>..<max>,N<M|N> (the fields in any
+// order, C0, M0 and NM unless given). Returns 0 if it is none.
+static int parseLargerThanLife(LifeRule &rule, const char *sRule)
+{
+	int iSeen[2] = { 0, 0 }, iStates = 0;
+	rule.iRadius = 0;
+	rule.neighbourhood = LIFE_MOORE;
+	rule.iMiddle = 0;
+
+	for(const char *sField = sRule; ; sField++)
+	{
+		const char *sEnd = NULL;
+		switch(toupper((unsigned char) *sField))
+		{
+			case 'R':
+				sEnd = parseNumber(sField + 1, rule.iRadius);
+				break;
+			case 'C':
+				sEnd = parseNumber(sField + 1, iStates);
+				break;
+			case 'M':
+				sEnd = parseNumber(sField + 1, rule.iMiddle);
+				break;
+			case 'S':
+				if(parseRange(sField + 1, rule.iSurvivalMin, rule.iSurvivalMax))
+				{
+					iSeen[0] = 1;
+					sEnd = sField + strcspn(sField, ",");
+				}
+				break;
+			case 'B':
+				if(parseRange(sField + 1, rule.iBirthMin, rule.iBirthMax))
+				{
+					iSeen[1] = 1;
+					sEnd = sField + strcspn(sField, ",");
+				}
+				break;
+			case 'N':
+				if(toupper((unsigned char) sField[1]) == 'M' || toupper((unsigned char) sField[1]) == 'N')
+				{
+					rule.neighbourhood = (toupper((unsigned char) sField[1]) == 'M') ? LIFE_MOORE : LIFE_VON_NEUMANN;
+					sEnd = sField + 2;
+				}
+				break;
+		}
+		if(!sEnd || (*sEnd != ',' && *sEnd != '\0'))
+			return 0;
+		if(*sEnd == '\0')
+			break;
+		sField = sEnd;
+	}
+
+	// Two states only, every count within the neighbourhood, no birth without live cells
+	if(!iSeen[0] || !iSeen[1] || (iStates != 0 && iStates != 2) || rule.iMiddle > 1 ||
+	   rule.iRadius < 1 || rule.iRadius > LIFE_RULE_MAX_RADIUS || rule.iBirthMin < 1 ||
+	   rule.iBirthMax > neighbourhoodSize(rule) || rule.iSurvivalMax > neighbourhoodSize(rule))
+		return 0;
+
+	// The masks of the rule, the radius 1 Moore rules run on the kernels of the Life-like rules
+	rule.uBirth = rule.uSurvival = 0;
+	for(int k = 0; k <= 8; k++)
+	{
+		if(k >= rule.iBirthMin && k <= rule.iBirthMax)
+			rule.uBirth |= 1u << k;
+		if(k + rule.iMiddle >= rule.iSurvivalMin && k + rule.iMiddle <= rule.iSurvivalMax)
+			rule.uSurvival |= 1u << k;
+	}
+	return 1;
+}
+
+// Neighbour counts of the digits up to the next '/' (or the end), into uCounts. Returns the end of the digits or NULL.
+static const char *parseCounts(const char *sDigits, unsigned &uCounts)
+{
+	uCounts = 0;
+	for(; *sDigits && *sDigits != '/'; sDigits++)
+	{
+		if(*sDigits < '0' || *sDigits > '8')
+			return NULL;
+		uCounts |= 1u << (*sDigits - '0');
+	}
+	return sDigits;
+}
+
+// Read a rule given as "B<digits>/S<digits>" (upper or lower case, either half first), as a Larger than Life rule or by its name.
+// Returns 0 if it is none of these
+// or if it gives birth to cells without live neighbours (B0): the dead space around a pattern would not stay dead.
+int parseRule(LifeRule &rule, const char *sRule)
+{
+	const int iNamedRules = sizeof(namedRules) / sizeof(namedRules[0]);
+	for(int i = 0; i < iNamedRules; i++)
+		if(strcmp(sRule, namedRules[i].cName) == 0)
+			return parseRule(rule, namedRules[i].cRule);
+
+	createRule(rule);
+	if(toupper((unsigned char) sRule[0]) == 'R')
+		return parseLargerThanLife(rule, sRule);
+
+	int iBirthSeen = 0, iSurvivalSeen = 0;
+	const char *sPart = sRule;
+	for(int iPart = 0; iPart < 2; iPart++)
+	{
+		char cKind = (char) toupper((unsigned char) *sPart);
+		unsigned uCounts;
+		const char *sEnd = (cKind == 'B' || cKind == 'S') ? parseCounts(sPart + 1, uCounts) : NULL;
+		if(!sEnd)
+			return 0;
+
+		if(cKind == 'B' && !iBirthSeen)
+		{
+			rule.uBirth = uCounts;
+			iBirthSeen = 1;
+		}
+		else if(cKind == 'S' && !iSurvivalSeen)
+		{
+			rule.uSurvival = uCounts;
+			iSurvivalSeen = 1;
+		}
+		else
+			return 0;
+
+		if(iPart == 0 && *sEnd != '/')
+			return 0;
+		if(iPart == 1 && *sEnd)
+			return 0;
+		sPart = sEnd + 1;
+	}
+	return (rule.uBirth & 1u) == 0;
+}
+
+// Name of the rule in B/S notation (or in the notation of the Larger than Life rules)
+void formatRule(const LifeRule &rule, char sName[LIFE_RULE_NAME_SIZE])
+{
+	if(isLargerThanLife(rule))
+	{
+		snprintf(sName, LIFE_RULE_NAME_SIZE, "R%d,C0,M%d,S%d..%d,B%d..%d,N%c", rule.iRadius, rule.iMiddle, rule.iSurvivalMin,
+				 rule.iSurvivalMax, rule.iBirthMin, rule.iBirthMax, (rule.neighbourhood == LIFE_MOORE) ? 'M' : 'N');
+		return;
+	}
+
+	char *sNext = sName;
+	*sNext++ = 'B';
+	for(int k = 0; k <= 8; k++)
+		if(rule.uBirth & (1u << k))
+			*sNext++ = (char) ('0' + k);
+	*sNext++ = '/';
+	*sNext++ = 'S';
+	for(int k = 0; k <= 8; k++)
+		if(rule.uSurvival & (1u << k))
+			*sNext++ = (char) ('0' + k);
+	*sNext = '\0';
+}
+
+// The Game of Life itself
+int isConwayRule(const LifeRule &rule)
+{
+	return !isLargerThanLife(rule) && rule.uBirth == LIFE_CONWAY_BIRTH && rule.uSurvival == LIFE_CONWAY_SURVIVAL;
+}
@@ -0,0 +1,61 @@
+/*
+ * The rules of the Life-like cellular automata.
+ *
+ * A rule is given in B/S notation: B3/S23 (the Game of Life) means that a dead
+ * cell with three live neighbours is born and a live cell with two or three live
+ * neighbours survives, all other cells die or stay dead. Some rules are known by
+ * their name as well (highlife is B36/S23). The rule is kept as two masks: bit k
+ * of uBirth (uSurvival) is set when a dead (live) cell with k live neighbours is
+ * alive in the next generation. Rules with B0 are not supported.
+ *
+ * Larger than Life rules count the live cells within a radius r: the square
+ * of (2r + 1) * (2r + 1) cells (Moore) or the diamond of the cells at most r
+ * steps away (von Neumann). They are given as R<r>,C0,M<0|1>,S<min>..<max>,
+ * B<min>..<max>,N<M|N>: M1 counts the cell itself as well, a live cell
+ * survives with a count in the range of S and a dead cell is born with a count
+ * in the range of B. A radius 1 Moore rule is turned into its B/S masks.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.1 10/17/2026
+ *
+ */
+
+#if !defined LIFE_RULE_H
+#define LIFE_RULE_H
+
+// The Game of Life: B3/S23
+#define LIFE_CONWAY_BIRTH 0x008
+#define LIFE_CONWAY_SURVIVAL 0x00c
+
+// Longest name of a rule (R16,C0,M1,S1089..1089,B1089..1089,NM)
+#define LIFE_RULE_NAME_SIZE 48
+
+// Largest radius of a neighbourhood
+#define LIFE_RULE_MAX_RADIUS 16
+
+// Neighbourhoods of the Larger than Life rules
+enum LifeNeighbourhood
+{
+	LIFE_MOORE, LIFE_VON_NEUMANN
+};
+
+// A Life-like rule
+struct LifeRule
+{
+	unsigned uBirth;					// Neighbour counts giving birth to a dead cell
+	unsigned uSurvival;					// Neighbour counts keeping a live cell alive
+	int iRadius;						// Radius of the neighbourhood
+	LifeNeighbourhood neighbourhood;	// Square or diamond (Larger than Life rules)
+	int iMiddle;						// The cell counts itself (Larger than Life rules)
+	int iBirthMin, iBirthMax;			// Counts giving birth to a dead cell (Larger than Life rules)
+	int iSurvivalMin, iSurvivalMax;		// Counts keeping a live cell alive (Larger than Life rules)
+};
+
+// Signature of the methods
+void createRule(LifeRule &rule);
+int isLargerThanLife(const LifeRule &rule);
+int parseRule(LifeRule &rule, const char *sRule);
+void formatRule(const LifeRule &rule, char sName[LIFE_RULE_NAME_SIZE]);
+int isConwayRule(const LifeRule &rule);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * The sharing of the stencil among the OpenMP threads.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.2 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+#include <omp.h>
+
+// Including the schedule of the stencil
+#include "life_schedule.h"
+
+// Static schedule of tiles of the default size
+void createSchedule(LifeSchedule &schedule)
+{
+	schedule.kind = LIFE_SCHEDULE_STATIC;
+	schedule.iChunk = 0;
+	schedule.iTileRows = LIFE_SCHEDULE_TILE_ROWS;
+	schedule.iTileWords = LIFE_SCHEDULE_TILE_COLUMNS / LIFE_WORD_BITS;
+}
+
+// Read a schedule given as "static", "dynamic" or "guided", optionally followed by ",<chunk>". Returns 0 if it is none of these.
+int parseSchedule(LifeSchedule &schedule, const char *sSchedule)
+{
+	const char *sComma = strchr(sSchedule, ',');
+	size_t iLength = sComma ? (size_t) (sComma - sSchedule) : strlen(sSchedule);
+
+	if(iLength == 6 && strncmp(sSchedule, "static", 6) == 0)
+		schedule.kind = LIFE_SCHEDULE_STATIC;
+	else if(iLength == 7 && strncmp(sSchedule, "dynamic", 7) == 0)
+		schedule.kind = LIFE_SCHEDULE_DYNAMIC;
+	else if(iLength == 6 && strncmp(sSchedule, "guided", 6) == 0)
+		schedule.kind = LIFE_SCHEDULE_GUIDED;
+	else
+		return 0;
+
+	schedule.iChunk = sComma ? atoi(sComma + 1) : 0;
+	return schedule.iChunk >= 0;
+}
+
+// Read the tiles given as "<rows>x<columns>", the columns are rounded up to whole words. Returns 0 if they are not valid.
+int parseTile(LifeSchedule &schedule, const char *sTile)
+{
+	const char *sCross = strchr(sTile, 'x');
+	if(!sCross)
+		return 0;
+
+	int iRows = atoi(sTile), iColumns = atoi(sCross + 1);
+	if(iRows < 1 || iColumns < 1)
+		return 0;
+
+	schedule.iTileRows = iRows;
+	schedule.iTileWords = (iColumns + LIFE_WORD_BITS - 1) / LIFE_WORD_BITS;
+	return 1;
+}
+
+// Make the schedule the one of the loops of schedule(runtime) in the parallel regions to come
+void applySchedule(const LifeSchedule &schedule)
+{
+	const omp_sched_t kinds[] = { omp_sched_static, omp_sched_dynamic, omp_sched_guided };
+	omp_set_schedule(kinds[schedule.kind], schedule.iChunk);
+}
+
+// Name of the schedule
+const char *getScheduleName(const LifeSchedule &schedule)
+{
+	const char *sNames[] = { "static", "dynamic", "guided" };
+	return sNames[schedule.kind];
+}
+
+// Compute the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) of the next generation into gridNew, tile by tile.
+// Called by all threads of a parallel region (after applySchedule), the tiles are shared among them.
+// The threads do not wait for each other at the end: a barrier is up to the caller.
+void nextGenerationScheduled(const LifeSchedule &schedule, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd,
+							 LifeStats *stats)
+{
+	int iTileRowCount = (iRowEnd > iRowStart) ? (iRowEnd - iRowStart + schedule.iTileRows - 1) / schedule.iTileRows : 0;
+	int iTileColumnCount = (iWordEnd > iWordStart) ? (iWordEnd - iWordStart + schedule.iTileWords - 1) / schedule.iTileWords : 0;
+
+	#pragma omp for schedule(runtime) nowait
+	for(int t = 0; t < iTileRowCount * iTileColumnCount; t++)
+	{
+		int iTileRowStart = iRowStart + (t / iTileColumnCount) * schedule.iTileRows;
+		int iTileRowEnd = (iTileRowStart + schedule.iTileRows < iRowEnd) ? iTileRowStart + schedule.iTileRows : iRowEnd;
+		int iTileWordStart = iWordStart + (t % iTileColumnCount) * schedule.iTileWords;
+		int iTileWordEnd = (iTileWordStart + schedule.iTileWords < iWordEnd) ? iTileWordStart + schedule.iTileWords : iWordEnd;
+
+		nextGenerationWords(grid, gridNew, iTileRowStart, iTileRowEnd, iTileWordStart, iTileWordEnd);
+
+		// The tile is counted while it is in cache
+		if(stats)
+			scanStats(*stats, omp_get_thread_num(), grid, gridNew, iTileRowStart, iTileRowEnd, iTileWordStart, iTileWordEnd);
+	}
+}
@@ -0,0 +1,51 @@
+/*
+ * The sharing of the stencil among the OpenMP threads.
+ *
+ * The rows to compute are cut into 2D tiles of iTileRows rows by iTileWords
+ * words, and the tiles are the iterations of an OpenMP loop. The schedule of
+ * the loop is picked at run time: static (equal shares fixed in advance),
+ * dynamic (the next tile goes to the next idle thread) or guided (shares
+ * shrinking towards the end), each with an optional chunk of tiles. Every tile
+ * is computed exactly once, whatever the numbers of rows and threads.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.1 10/17/2026
+ *
+ */
+
+#if !defined LIFE_SCHEDULE_H
+#define LIFE_SCHEDULE_H
+
+// Including the bit-packed grid
+#include "life_grid.h"
+#include "life_stats.h"
+
+// Rows and columns of a tile unless given otherwise
+#define LIFE_SCHEDULE_TILE_ROWS 32
+#define LIFE_SCHEDULE_TILE_COLUMNS 2048
+
+// Schedules of the loop over the tiles
+enum LifeScheduleKind
+{
+	LIFE_SCHEDULE_STATIC, LIFE_SCHEDULE_DYNAMIC, LIFE_SCHEDULE_GUIDED
+};
+
+// Schedule and tiles of the stencil
+struct LifeSchedule
+{
+	LifeScheduleKind kind;	// Schedule of the loop
+	int iChunk;				// Tiles handed out at once (0 for the default of the schedule)
+	int iTileRows;			// Rows of a tile
+	int iTileWords;			// Words of a tile
+};
+
+// Signature of the methods
+void createSchedule(LifeSchedule &schedule);
+int parseSchedule(LifeSchedule &schedule, const char *sSchedule);
+int parseTile(LifeSchedule &schedule, const char *sTile);
+void applySchedule(const LifeSchedule &schedule);
+const char *getScheduleName(const LifeSchedule &schedule);
+void nextGenerationScheduled(const LifeSchedule &schedule, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd,
+							 LifeStats *stats);
+
+#endif
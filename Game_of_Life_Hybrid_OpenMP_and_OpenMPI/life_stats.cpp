@@ -0,0 +1,408 @@
+/*
+ * The statistics of the generations of a bit-packed grid and the cycles they run into.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <cstdlib>
+#include <cstring>
+
+// Including the statistics of the generations
+#include "life_stats.h"
+
+// Keys of the quarters of a column of words: the key of the bit b is uQuarterKeys[b / 16] << (b % 16)
+static const uint64_t uQuarterKeys[4] = { 0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL, 0x165667b19e3779f9ULL, 0xd6e8feb86659fd93ULL };
+
+// Mix the bits of a 64-bit number (the finalizer of splitmix64)
+static inline uint64_t mixBits(uint64_t uValue)
+{
+	uValue ^= uValue >> 30;
+	uValue *= 0xbf58476d1ce4e5b9ULL;
+	uValue ^= uValue >> 27;
+	uValue *= 0x94d049bb133111ebULL;
+	uValue ^= uValue >> 31;
+	return uValue;
+}
+
+// Sum of the keys of the births less the sum of the keys of the deaths of a column of words of the plane,
+// a quarter at a time (every key keeps at least 49 bits of its quarter)
+static inline uint64_t sumBitKeys(LifeWord uBirths, LifeWord uDeaths)
+{
+	uint64_t uKey = 0;
+	for(int q = 0; q < 4; q++)
+		uKey += (((uBirths >> (16 * q)) & 0xffff) - ((uDeaths >> (16 * q)) & 0xffff)) * uQuarterKeys[q];
+	return uKey;
+}
+
+// Key of a row of the plane
+static inline uint64_t getRowKey(long long lRow)
+{
+	return mixBits((uint64_t) lRow * 0xd6e8feb86659fd93ULL + 0x2545f4914f6cdd1dULL) | 1;
+}
+
+// Key of a column of words of the plane (the key of a cell is the product of the keys of its row, its column of words and its bit)
+static inline uint64_t getColumnKey(long long lGroup)
+{
+	return mixBits((uint64_t) lGroup * 0x9e3779b97f4a7c15ULL + 0x632be59bd9b4e019ULL) | 1;
+}
+
+// Cells of the word w of a row which are counted
+static inline LifeWord getCountedMask(const LifeStats &stats, int w)
+{
+	LifeWord uMask = ~(LifeWord) 0;
+	if(w == stats.iFirstWord)
+		uMask &= stats.uFirstMask;
+	if(w == stats.iLastWord)
+		uMask &= stats.uLastMask;
+	return uMask;
+}
+
+// Nothing changed yet
+static void clearDelta(LifeStatsDelta &delta)
+{
+	delta.lBirths = delta.lDeaths = 0;
+	delta.uHash = 0;
+	delta.iRowMin = delta.iWordMin = 1 << 30;
+	delta.iRowMax = delta.iWordMax = -1;
+}
+
+// Add the births and deaths of the words [iWordStart, iWordEnd) of a row to the changes of the columns of words (uOld is NULL
+// for a first count), only the cells of uStartMask and uEndMask of the first and the last word are counted. The keys of
+// the cells which changed, short of the key of the row, are summed into uHash. Returns the change of the live cells of the row.
+static inline __attribute__((always_inline)) int scanRow(const LifeWord *uOld, const LifeWord *uNew, int iWordStart, int iWordEnd,
+														 LifeWord uStartMask, LifeWord uEndMask, int iShift, const uint64_t *uColumnKeys,
+														 int *iWordChanges, int64_t &lBirths, int64_t &lDeaths, uint64_t &uHash)
+{
+	LifeWord uBirthCarry = 0, uDeathCarry = 0;
+	int iBirths = 0, iDeaths = 0;
+
+	for(int w = iWordStart; w < iWordEnd; w++)
+	{
+		LifeWord uMask = (w == iWordStart) ? uStartMask : ~(LifeWord) 0;
+		if(w == iWordEnd - 1)
+			uMask &= uEndMask;
+		LifeWord uNewBits = uNew[w] & uMask;
+		LifeWord uOldBits = uOld ? (uOld[w] & uMask) : 0;
+		LifeWord uBirths = uNewBits & ~uOldBits;
+		LifeWord uDeaths = uOldBits & ~uNewBits;
+
+		int iBorn = __builtin_popcountll(uBirths), iDied = __builtin_popcountll(uDeaths);
+		iBirths += iBorn;
+		iDeaths += iDied;
+		iWordChanges[w] += iBorn - iDied;
+
+		// The column of words of the plane of the bit 0 holds the cells of this word shifted by iShift and those carried from the word before
+		LifeWord uBirthBits = (uBirths << iShift) | uBirthCarry;
+		LifeWord uDeathBits = (uDeaths << iShift) | uDeathCarry;
+		if(uBirthBits | uDeathBits)
+			uHash += uColumnKeys[w] * sumBitKeys(uBirthBits, uDeathBits);
+
+		uBirthCarry = iShift ? uBirths >> (LIFE_WORD_BITS - iShift) : 0;
+		uDeathCarry = iShift ? uDeaths >> (LIFE_WORD_BITS - iShift) : 0;
+	}
+
+	// The cells of the last word carried into the next column of words of the plane
+	if(uBirthCarry | uDeathCarry)
+		uHash += uColumnKeys[iWordEnd] * sumBitKeys(uBirthCarry, uDeathCarry);
+
+	lBirths += iBirths;
+	lDeaths += iDeaths;
+	return iBirths - iDeaths;
+}
+
+// The thread scans the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) of grid (NULL for a first count) and gridNew,
+// its counters are added to once
+static inline __attribute__((always_inline)) void scanBlock(const LifeStats &stats, LifeStatsDelta &delta, const LifeGrid *grid, const LifeGrid &gridNew,
+															int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	LifeWord uStartMask = (iWordStart == stats.iFirstWord) ? stats.uFirstMask : ~(LifeWord) 0;
+	LifeWord uEndMask = (iWordEnd - 1 == stats.iLastWord) ? stats.uLastMask : ~(LifeWord) 0;
+	int64_t lBirths = 0, lDeaths = 0;
+	uint64_t uHash = 0;
+
+	for(int i = iRowStart; i < iRowEnd; i++)
+	{
+		uint64_t uRowHash = 0;
+		delta.iRowChanges[i] += scanRow(grid ? getRow(*grid, i) : NULL, getRow(gridNew, i), iWordStart, iWordEnd, uStartMask, uEndMask,
+										stats.iShift, stats.uColumnKeys, delta.iWordChanges, lBirths, lDeaths, uRowHash);
+		if(uRowHash)
+			uHash += getRowKey(stats.lRowOrigin + i) * uRowHash;
+	}
+
+	delta.lBirths += lBirths;
+	delta.lDeaths += lDeaths;
+	delta.uHash += uHash;
+}
+
+// Scan the block counting the cells with the popcnt instruction
+__attribute__((target("popcnt")))
+static void scanBlockPopcnt(const LifeStats &stats, LifeStatsDelta &delta, const LifeGrid *grid, const LifeGrid &gridNew,
+								int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	scanBlock(stats, delta, grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+}
+
+// Scan the block on any processor
+static void scanBlockGeneric(const LifeStats &stats, LifeStatsDelta &delta, const LifeGrid *grid, const LifeGrid &gridNew,
+								int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	scanBlock(stats, delta, grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+}
+
+// The scan chosen for the processor
+typedef void (*LifeScanBlock)(const LifeStats &, LifeStatsDelta &, const LifeGrid *, const LifeGrid &, int, int, int, int);
+static LifeScanBlock scanBlockChosen = scanBlockGeneric;
+
+// Count the cells of the grid between its rows [iRowStart, iRowEnd) and columns [iColumnStart, iColumnEnd) as the generation uGeneration.
+// The cell (0, 0) of the grid is the cell (lRowOrigin, lColumnOrigin) of the plane. Up to iThreadCount threads scan the next generations.
+void createStats(LifeStats &stats, const LifeGrid &grid, int iRowStart, int iRowEnd, int iColumnStart, int iColumnEnd,
+				 long long lRowOrigin, long long lColumnOrigin, int iThreadCount, uint64_t uGeneration)
+{
+	__builtin_cpu_init();
+	scanBlockChosen = __builtin_cpu_supports("popcnt") ? scanBlockPopcnt : scanBlockGeneric;
+
+	stats.iRowStart = iRowStart;
+	stats.iRowEnd = iRowEnd;
+	stats.iColumnStart = iColumnStart;
+	stats.iColumnEnd = iColumnEnd;
+	stats.iFirstWord = iColumnStart / LIFE_WORD_BITS;
+	stats.iLastWord = (iColumnEnd - 1) / LIFE_WORD_BITS;
+	stats.uFirstMask = ~(LifeWord) 0 << (iColumnStart % LIFE_WORD_BITS);
+	stats.uLastMask = (iColumnEnd % LIFE_WORD_BITS) ? ((LifeWord) 1 << (iColumnEnd % LIFE_WORD_BITS)) - 1 : ~(LifeWord) 0;
+	stats.lRowOrigin = lRowOrigin;
+	stats.lColumnOrigin = lColumnOrigin;
+
+	// Column of words of the plane of the column 0, rounded down
+	stats.lFirstGroup = lColumnOrigin / LIFE_WORD_BITS;
+	if(lColumnOrigin % LIFE_WORD_BITS < 0)
+		stats.lFirstGroup--;
+	stats.iShift = (int) (lColumnOrigin - stats.lFirstGroup * LIFE_WORD_BITS);
+
+	stats.uColumnKeys = (uint64_t *) malloc((grid.iWordCount + 1) * sizeof(uint64_t));
+	for(int w = 0; w <= grid.iWordCount; w++)
+		stats.uColumnKeys[w] = getColumnKey(stats.lFirstGroup + w);
+
+	stats.iRowCounts = (int *) calloc(grid.iRowCount, sizeof(int));
+	stats.iWordCounts = (int *) calloc(grid.iWordCount + 1, sizeof(int));
+	stats.iThreadCount = iThreadCount;
+	stats.deltas = (LifeStatsDelta *) calloc(iThreadCount, sizeof(LifeStatsDelta));
+	for(int t = 0; t < iThreadCount; t++)
+	{
+		stats.deltas[t].iRowChanges = (int *) calloc(grid.iRowCount, sizeof(int));
+		stats.deltas[t].iWordChanges = (int *) calloc(grid.iWordCount + 1, sizeof(int));
+		clearDelta(stats.deltas[t]);
+	}
+
+	// The first count is the births of every live cell
+	memset(&stats.generation, 0, sizeof(LifeGeneration));
+	stats.generation.uGeneration = uGeneration - 1;
+	scanStats(stats, 0, grid, grid, iRowStart, iRowEnd, 0, grid.iWordCount);
+	finishStats(stats, grid);
+	stats.generation.lBirths = stats.generation.lDeaths = 0;
+}
+
+// Free the statistics
+void freeStats(LifeStats &stats)
+{
+	for(int t = 0; t < stats.iThreadCount; t++)
+	{
+		free(stats.deltas[t].iRowChanges);
+		free(stats.deltas[t].iWordChanges);
+	}
+	free(stats.deltas);
+	free(stats.iRowCounts);
+	free(stats.iWordCounts);
+	free(stats.uColumnKeys);
+	stats.deltas = NULL;
+	stats.uColumnKeys = NULL;
+	stats.iRowCounts = stats.iWordCounts = NULL;
+}
+
+// The thread iThread computed the words [iWordStart, iWordEnd) of the rows [iRowStart, iRowEnd) of gridNew from grid:
+// add the cells of them which changed to its changes. With gridNew being grid every live cell counts as a birth.
+void scanStats(LifeStats &stats, int iThread, const LifeGrid &grid, const LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd)
+{
+	if(iRowStart < stats.iRowStart)
+		iRowStart = stats.iRowStart;
+	if(iRowEnd > stats.iRowEnd)
+		iRowEnd = stats.iRowEnd;
+	if(iWordStart < stats.iFirstWord)
+		iWordStart = stats.iFirstWord;
+	if(iWordEnd > stats.iLastWord + 1)
+		iWordEnd = stats.iLastWord + 1;
+	if(iRowStart >= iRowEnd || iWordStart >= iWordEnd)
+		return;
+
+	// The changes of the rows and the columns of words touched are summed by finishStats
+	LifeStatsDelta &delta = stats.deltas[iThread];
+	scanBlockChosen(stats, delta, (&grid == &gridNew) ? NULL : &grid, gridNew, iRowStart, iRowEnd, iWordStart, iWordEnd);
+	if(iRowStart < delta.iRowMin)
+		delta.iRowMin = iRowStart;
+	if(iRowEnd - 1 > delta.iRowMax)
+		delta.iRowMax = iRowEnd - 1;
+	if(iWordStart < delta.iWordMin)
+		delta.iWordMin = iWordStart;
+	if(iWordEnd - 1 > delta.iWordMax)
+		delta.iWordMax = iWordEnd - 1;
+}
+
+// Compute the rows [iRowStart, iRowEnd) of the next generation into gridNew, counting them while they are in cache
+void nextGenerationCounted(LifeStats &stats, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd)
+{
+	for(int i = iRowStart; i < iRowEnd; i += LIFE_STATS_ROWS)
+	{
+		int iEnd = (i + LIFE_STATS_ROWS < iRowEnd) ? i + LIFE_STATS_ROWS : iRowEnd;
+		nextGenerationWords(grid, gridNew, i, iEnd, 0, grid.iWordCount);
+		scanStats(stats, 0, grid, gridNew, i, iEnd, 0, grid.iWordCount);
+	}
+}
+
+// Every thread scanned the new generation gridNew: sum their changes into the statistics of the generation
+void finishStats(LifeStats &stats, const LifeGrid &gridNew)
+{
+	LifeGeneration &generation = stats.generation;
+	generation.lBirths = generation.lDeaths = 0;
+
+	for(int t = 0; t < stats.iThreadCount; t++)
+	{
+		LifeStatsDelta &delta = stats.deltas[t];
+		generation.lBirths += delta.lBirths;
+		generation.lDeaths += delta.lDeaths;
+		generation.uHash += delta.uHash;
+
+		for(int i = delta.iRowMin; i <= delta.iRowMax; i++)
+		{
+			stats.iRowCounts[i] += delta.iRowChanges[i];
+			delta.iRowChanges[i] = 0;
+		}
+		for(int w = delta.iWordMin; w <= delta.iWordMax; w++)
+		{
+			stats.iWordCounts[w] += delta.iWordChanges[w];
+			delta.iWordChanges[w] = 0;
+		}
+		clearDelta(delta);
+	}
+
+	generation.lPopulation += generation.lBirths - generation.lDeaths;
+	generation.uGeneration++;
+
+	// The rows and the columns of words holding live cells
+	int iTop = stats.iRowStart, iBottom = stats.iRowEnd;
+	while(iTop < iBottom && !stats.iRowCounts[iTop])
+		iTop++;
+	while(iBottom > iTop && !stats.iRowCounts[iBottom - 1])
+		iBottom--;
+
+	int iFirstWord = stats.iFirstWord, iLastWord = stats.iLastWord;
+	while(iFirstWord <= iLastWord && !stats.iWordCounts[iFirstWord])
+		iFirstWord++;
+	while(iLastWord >= iFirstWord && !stats.iWordCounts[iLastWord])
+		iLastWord--;
+
+	if(iTop >= iBottom || iFirstWord > iLastWord)
+	{
+		generation.lTop = generation.lLeft = INT64_MAX;
+		generation.lBottom = generation.lRight = INT64_MIN;
+		return;
+	}
+
+	// The live cells of the first and the last column of words in any row
+	LifeWord uFirstBits = 0, uLastBits = 0;
+	for(int i = iTop; i < iBottom; i++)
+	{
+		const LifeWord *uRow = getRow(gridNew, i);
+		uFirstBits |= uRow[iFirstWord];
+		uLastBits |= uRow[iLastWord];
+	}
+	uFirstBits &= getCountedMask(stats, iFirstWord);
+	uLastBits &= getCountedMask(stats, iLastWord);
+
+	generation.lTop = stats.lRowOrigin + iTop;
+	generation.lBottom = stats.lRowOrigin + iBottom;
+	generation.lLeft = stats.lColumnOrigin + (long long) iFirstWord * LIFE_WORD_BITS + __builtin_ctzll(uFirstBits);
+	generation.lRight = stats.lColumnOrigin + (long long) iLastWord * LIFE_WORD_BITS + LIFE_WORD_BITS - __builtin_clzll(uLastBits);
+}
+
+// Add the statistics of another block of the same generation
+void combineGenerations(LifeGeneration &generation, const LifeGeneration &other)
+{
+	generation.lPopulation += other.lPopulation;
+	generation.lBirths += other.lBirths;
+	generation.lDeaths += other.lDeaths;
+	generation.uHash += other.uHash;
+	if(other.lTop < generation.lTop)
+		generation.lTop = other.lTop;
+	if(other.lBottom > generation.lBottom)
+		generation.lBottom = other.lBottom;
+	if(other.lLeft < generation.lLeft)
+		generation.lLeft = other.lLeft;
+	if(other.lRight > generation.lRight)
+		generation.lRight = other.lRight;
+}
+
+// Write the names of the columns of the statistics
+void writeStatsHeader(FILE *pFile)
+{
+	fprintf(pFile, "# generation population births deaths top left bottom right hash\n");
+}
+
+// Write the statistics of a generation on a line: the bounding box of the live cells as the rows [top, bottom) and the columns [left, right)
+void writeGeneration(FILE *pFile, const LifeGeneration &generation)
+{
+	fprintf(pFile, "%llu %lld %lld %lld ", (unsigned long long) generation.uGeneration, (long long) generation.lPopulation,
+			(long long) generation.lBirths, (long long) generation.lDeaths);
+	if(generation.lTop > generation.lBottom)
+		fprintf(pFile, "- - - - ");
+	else
+		fprintf(pFile, "%lld %lld %lld %lld ", (long long) generation.lTop, (long long) generation.lLeft,
+				(long long) generation.lBottom, (long long) generation.lRight);
+	fprintf(pFile, "%016llx\n", (unsigned long long) generation.uHash);
+}
+
+// Look for cycles of a period up to iMaxPeriod
+void createCycle(LifeCycle &cycle, int iMaxPeriod)
+{
+	cycle.iMaxPeriod = iMaxPeriod;
+	cycle.history = (LifeGeneration *) calloc(iMaxPeriod, sizeof(LifeGeneration));
+	cycle.iRecorded = 0;
+	cycle.iNext = 0;
+	cycle.iPeriod = 0;
+	cycle.uGeneration = 0;
+}
+
+// Free the cycle
+void freeCycle(LifeCycle &cycle)
+{
+	free(cycle.history);
+	cycle.history = NULL;
+}
+
+// Record the next generation. Returns the period of the cycle it closes (its hash, population and bounding box are
+// those of the generation that many generations before), 0 if none.
+int findCycle(LifeCycle &cycle, const LifeGeneration &generation)
+{
+	int iPeriod = 0;
+	for(int p = 1; p <= cycle.iRecorded && !iPeriod; p++)
+	{
+		const LifeGeneration &before = cycle.history[(cycle.iNext - p + cycle.iMaxPeriod) % cycle.iMaxPeriod];
+		if(before.uGeneration + p == generation.uGeneration && before.uHash == generation.uHash &&
+		   before.lPopulation == generation.lPopulation && before.lTop == generation.lTop && before.lBottom == generation.lBottom &&
+		   before.lLeft == generation.lLeft && before.lRight == generation.lRight)
+			iPeriod = p;
+	}
+
+	if(iPeriod && !cycle.iPeriod)
+	{
+		cycle.iPeriod = iPeriod;
+		cycle.uGeneration = generation.uGeneration;
+	}
+
+	cycle.history[cycle.iNext] = generation;
+	cycle.iNext = (cycle.iNext + 1) % cycle.iMaxPeriod;
+	if(cycle.iRecorded < cycle.iMaxPeriod)
+		cycle.iRecorded++;
+	return iPeriod;
+}
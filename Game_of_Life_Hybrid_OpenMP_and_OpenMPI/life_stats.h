@@ -0,0 +1,114 @@
+/*
+ * The statistics of the generations of a bit-packed grid and the cycles they run into.
+ *
+ * Every generation counts its live cells, births and deaths, the bounding box
+ * of its live cells and a 64-bit hash of the grid. The kernels do not look at
+ * the grid a second time: right after a tile is computed (while it is still in
+ * cache) the words which changed add their births, deaths and the change of
+ * the hash to the counters of the thread (scanStats). The counters of the
+ * threads are summed once per generation (finishStats), the live cells of
+ * every row and of every column of words follow from them, and so do the
+ * population and the bounding box. A sparse grid which computes a few tiles
+ * only scans those few tiles.
+ *
+ * The hash is linear: every cell of the plane has a key (the product of the
+ * keys of its row, of its column of 64 cells and of its bit), and the hash is
+ * the sum of the keys of the live cells modulo 2^64. A generation updates the hash by
+ * the keys of the cells which changed (a rolling hash), and the blocks of
+ * several processes add up to the hash of the whole grid, whatever the blocks.
+ * Summing over the processes is a single reduction (combineGenerations).
+ *
+ * A generation with the hash and the population of a generation at most
+ * iMaxPeriod generations before closes a cycle: a still life (period 1) or an
+ * oscillator (findCycle).
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#if !defined LIFE_STATS_H
+#define LIFE_STATS_H
+
+// Including libraries
+#include <cstdio>
+#include <stdint.h>
+
+// Including the bit-packed grid
+#include "life_grid.h"
+
+// Longest period looked for unless given otherwise
+#define LIFE_CYCLE_PERIOD 64
+
+// Rows computed and scanned at once by nextGenerationCounted
+#define LIFE_STATS_ROWS 32
+
+// Statistics of a generation (of a block, or of the whole grid once combined)
+struct LifeGeneration
+{
+	uint64_t uGeneration;
+	int64_t lPopulation;				// Live cells
+	int64_t lBirths;					// Cells born in the generation
+	int64_t lDeaths;					// Cells died in the generation
+	int64_t lTop, lBottom;				// Rows of the plane holding live cells: [lTop, lBottom) (lTop > lBottom if none)
+	int64_t lLeft, lRight;				// Columns of the plane holding live cells: [lLeft, lRight)
+	uint64_t uHash;						// Sum of the keys of the live cells
+};
+
+// Changes found by a thread in the generation being computed
+struct LifeStatsDelta
+{
+	int64_t lBirths;
+	int64_t lDeaths;
+	uint64_t uHash;						// Change of the hash
+	int *iRowChanges;					// Change of the live cells of every row
+	int *iWordChanges;					// Change of the live cells of every column of words
+	int iRowMin, iRowMax;				// Rows scanned (iRowMin > iRowMax if none)
+	int iWordMin, iWordMax;				// Columns of words scanned
+};
+
+// Statistics of the generations of the cells of a grid between its outer layers (or halos)
+struct LifeStats
+{
+	int iRowStart, iRowEnd;				// Rows of the grid counted
+	int iColumnStart, iColumnEnd;		// Columns of the grid counted
+	int iFirstWord, iLastWord;			// Words holding them
+	LifeWord uFirstMask, uLastMask;		// Cells counted of the first and the last word
+	long long lRowOrigin;				// Row of the plane of the row 0 of the grid
+	long long lColumnOrigin;			// Column of the plane of the column 0 of the grid
+	long long lFirstGroup;				// Column of words of the plane (64 columns from a multiple of 64) of the word 0 of a row
+	int iShift;							// Bit of that column of words holding the column 0
+	uint64_t *uColumnKeys;				// Keys of the columns of words of the plane from lFirstGroup on
+	int *iRowCounts;					// Live cells of every row
+	int *iWordCounts;					// Live cells of every column of words
+	int iThreadCount;
+	LifeStatsDelta *deltas;				// Changes found by every thread
+	LifeGeneration generation;			// The last generation
+};
+
+// Cycle of the generations
+struct LifeCycle
+{
+	int iMaxPeriod;						// Longest period looked for
+	LifeGeneration *history;			// The last iMaxPeriod generations (a ring)
+	int iRecorded;						// Generations in the ring
+	int iNext;							// Place of the next generation in the ring
+	int iPeriod;						// Period of the first cycle found (0 while there is none)
+	uint64_t uGeneration;				// Generation closing it
+};
+
+// Signature of the methods
+void createStats(LifeStats &stats, const LifeGrid &grid, int iRowStart, int iRowEnd, int iColumnStart, int iColumnEnd,
+				 long long lRowOrigin, long long lColumnOrigin, int iThreadCount, uint64_t uGeneration);
+void freeStats(LifeStats &stats);
+void scanStats(LifeStats &stats, int iThread, const LifeGrid &grid, const LifeGrid &gridNew, int iRowStart, int iRowEnd, int iWordStart, int iWordEnd);
+void nextGenerationCounted(LifeStats &stats, const LifeGrid &grid, LifeGrid &gridNew, int iRowStart, int iRowEnd);
+void finishStats(LifeStats &stats, const LifeGrid &gridNew);
+void combineGenerations(LifeGeneration &generation, const LifeGeneration &other);
+void writeStatsHeader(FILE *pFile);
+void writeGeneration(FILE *pFile, const LifeGeneration &generation);
+void createCycle(LifeCycle &cycle, int iMaxPeriod);
+void freeCycle(LifeCycle &cycle);
+int findCycle(LifeCycle &cycle, const LifeGeneration &generation);
+
+#endif
@@ -0,0 +1,432 @@
+/*
+ * The snapshot stream of the Game of Life: every iEvery-th generation of a run as a frame of one file.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+// Including libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+// Including the snapshot stream
+#include "life_stream.h"
+
+using namespace std;
+
+// Bytes of the run-length encoding of iBytes bytes at most
+static size_t encodedBound(size_t iBytes)
+{
+	return iBytes + iBytes / 64 + 32;
+}
+
+// Append uValue as a LEB128 number
+static unsigned char *putNumber(unsigned char *cOut, uint64_t uValue)
+{
+	while(uValue >= 0x80)
+	{
+		*cOut++ = (unsigned char) (uValue | 0x80);
+		uValue >>= 7;
+	}
+	*cOut++ = (unsigned char) uValue;
+	return cOut;
+}
+
+// Read a LEB128 number before cEnd into uValue. Returns the byte behind it or NULL.
+static const unsigned char *getNumber(const unsigned char *cIn, const unsigned char *cEnd, uint64_t &uValue)
+{
+	uValue = 0;
+	for(int iShift = 0; cIn < cEnd && iShift < 64; iShift += 7)
+	{
+		unsigned char c = *cIn++;
+		uValue |= (uint64_t) (c & 0x7f) << iShift;
+		if(!(c & 0x80))
+			return cIn;
+	}
+	return NULL;
+}
+
+// High bit of every zero byte of the word
+static inline uint64_t zeroBytes(uint64_t uWord)
+{
+	const uint64_t uLow = 0x7f7f7f7f7f7f7f7full;
+	return ~(((uWord & uLow) + uLow) | uWord) & ~uLow;
+}
+
+// Run-length encode iBytes bytes into cOut. Returns the bytes of the encoding.
+// A literal run goes on over single zero bytes, it stops before two of them. Both runs are looked for a word at a time.
+static size_t encodeRows(const unsigned char *cBytes, size_t iBytes, unsigned char *cOut)
+{
+	unsigned char *cNext = cOut;
+	size_t k = 0;
+	uint64_t uWord, uZeros;
+
+	while(k < iBytes)
+	{
+		// Up to the first byte which is not zero
+		size_t iZeroStart = k;
+		for(; k + sizeof(uWord) <= iBytes; k += sizeof(uWord))
+		{
+			memcpy(&uWord, cBytes + k, sizeof(uWord));
+			if(uWord)
+			{
+				k += __builtin_ctzll(uWord) / 8;
+				break;
+			}
+		}
+		if(k + sizeof(uWord) > iBytes)
+			while(k < iBytes && cBytes[k] == 0)
+				k++;
+
+		// Up to the first two zero bytes in a row (the last byte of a word pairs with the first one of the next word)
+		size_t iLiteralStart = k;
+		for(; k + sizeof(uWord) < iBytes; k += sizeof(uWord))
+		{
+			memcpy(&uWord, cBytes + k, sizeof(uWord));
+			uZeros = zeroBytes(uWord);
+			uZeros &= (uZeros >> 8) | ((cBytes[k + sizeof(uWord)] == 0) ? 0x8000000000000000ull : 0);
+			if(uZeros)
+			{
+				k += __builtin_ctzll(uZeros) / 8;
+				break;
+			}
+		}
+		if(k + sizeof(uWord) >= iBytes)
+			while(k < iBytes && (cBytes[k] != 0 || (k + 1 < iBytes && cBytes[k + 1] != 0)))
+				k++;
+
+		cNext = putNumber(cNext, iLiteralStart - iZeroStart);
+		cNext = putNumber(cNext, k - iLiteralStart);
+		memcpy(cNext, cBytes + iLiteralStart, k - iLiteralStart);
+		cNext += k - iLiteralStart;
+	}
+
+	return cNext - cOut;
+}
+
+// Decode iEncodedBytes into iBytes bytes of cRows (XOR onto the bytes already there for a delta). Returns 0 if the encoding is broken.
+static int decodeRows(const unsigned char *cEncoded, size_t iEncodedBytes, unsigned char *cRows, size_t iBytes, int iDelta)
+{
+	const unsigned char *cIn = cEncoded, *cEnd = cEncoded + iEncodedBytes;
+	size_t k = 0;
+
+	while(cIn < cEnd)
+	{
+		uint64_t uZeros, uLiterals;
+		cIn = getNumber(cIn, cEnd, uZeros);
+		if(cIn)
+			cIn = getNumber(cIn, cEnd, uLiterals);
+		if(!cIn || uZeros > iBytes - k || uLiterals > iBytes - k - uZeros || uLiterals > (uint64_t) (cEnd - cIn))
+			return 0;
+
+		if(!iDelta)
+			memset(cRows + k, 0, uZeros);
+		k += uZeros;
+		for(uint64_t b = 0; b < uLiterals; b++, k++)
+			cRows[k] = iDelta ? (unsigned char) (cRows[k] ^ *cIn++) : *cIn++;
+	}
+
+	return k == iBytes;
+}
+
+// Checksum of the packed rows, the one of the binary grid file
+static uint64_t checksumFrame(const unsigned char *cRows, uint64_t uRowCount, uint64_t uColumnCount)
+{
+	size_t iRowBytes = lifeRowBytes((int) uColumnCount);
+	uint64_t uChecksum = 0;
+
+	for(uint64_t i = 0; i < uRowCount; i++)
+		uChecksum += checksumRow(cRows + i * iRowBytes, iRowBytes, i);
+
+	return uChecksum;
+}
+
+// Encode and write a frame, against the frame before unless a key frame is due
+static void writeFrame(LifeStream &stream, LifeFrame &frame)
+{
+	LifeFrameHeader &header = frame.header;
+	size_t iBytes = lifeFrameBytes(header.uRowCount, header.uColumnCount);
+
+	int iDelta = stream.cPrevious && header.uKind == LIFE_FRAME_DELTA && stream.previous.uRowCount == header.uRowCount &&
+				 stream.previous.uColumnCount == header.uColumnCount;
+	header.uKind = iDelta ? LIFE_FRAME_DELTA : LIFE_FRAME_KEY;
+	header.uChecksum = checksumFrame(frame.cRows, header.uRowCount, header.uColumnCount);
+
+	if(encodedBound(iBytes) > stream.iEncodedSize)
+	{
+		free(stream.cEncoded);
+		free(stream.cDelta);
+		stream.iEncodedSize = encodedBound(iBytes);
+		stream.cEncoded = (unsigned char *) malloc(stream.iEncodedSize);
+		stream.cDelta = (unsigned char *) malloc(stream.iEncodedSize);
+	}
+
+	// The difference to the frame before, a word at a time
+	const unsigned char *cBytes = frame.cRows;
+	if(iDelta)
+	{
+		size_t k = 0;
+		for(uint64_t uRow, uBase; k + sizeof(uRow) <= iBytes; k += sizeof(uRow))
+		{
+			memcpy(&uRow, frame.cRows + k, sizeof(uRow));
+			memcpy(&uBase, stream.cPrevious + k, sizeof(uBase));
+			uRow ^= uBase;
+			memcpy(stream.cDelta + k, &uRow, sizeof(uRow));
+		}
+		for(; k < iBytes; k++)
+			stream.cDelta[k] = frame.cRows[k] ^ stream.cPrevious[k];
+		cBytes = stream.cDelta;
+	}
+	header.uBytes = encodeRows(cBytes, iBytes, stream.cEncoded);
+
+	if(fwrite(&header, sizeof(header), 1, stream.pFile) != 1 || fwrite(stream.cEncoded, 1, header.uBytes, stream.pFile) != header.uBytes)
+		stream.iError = 1;
+	stream.lBytesWritten += (long) (sizeof(header) + header.uBytes);
+
+	// The rows are the base of the next delta
+	free(stream.cPrevious);
+	stream.cPrevious = frame.cRows;
+	stream.previous = header;
+}
+
+// The writer thread: takes the frames from the ring until the stream is closed and the ring is empty
+static void *writeFrames(void *pStream)
+{
+	LifeStream &stream = *(LifeStream *) pStream;
+
+	for(;;)
+	{
+		pthread_mutex_lock(&stream.mutex);
+		while(stream.iQueued == 0 && !stream.iClosing)
+			pthread_cond_wait(&stream.frameQueued, &stream.mutex);
+		if(stream.iQueued == 0)
+		{
+			pthread_mutex_unlock(&stream.mutex);
+			break;
+		}
+
+		LifeFrame frame = stream.queue[stream.iHead];
+		stream.iHead = (stream.iHead + 1) % LIFE_STREAM_QUEUE;
+		stream.iQueued--;
+		pthread_cond_signal(&stream.frameTaken);
+		pthread_mutex_unlock(&stream.mutex);
+
+		writeFrame(stream, frame);
+	}
+
+	return NULL;
+}
+
+// Create the stream file and start its writer, the run starting at generation uGeneration.
+// Returns 0 (with a message) when the file can not be created.
+int openStream(LifeStream &stream, const char *sFileName, int iEvery, uint64_t uGeneration)
+{
+	stream.pFile = fopen(sFileName, "wb");
+	if(!stream.pFile)
+	{
+		cerr << "Unable to create " << sFileName << endl;
+		return 0;
+	}
+
+	LifeStreamHeader header;
+	memset(&header, 0, sizeof(header));
+	header.uMagic = LIFE_STREAM_MAGIC;
+	header.uVersion = LIFE_STREAM_VERSION;
+	header.uHeaderSize = sizeof(LifeStreamHeader);
+	header.uKeyEvery = LIFE_STREAM_KEY_EVERY;
+
+	stream.iEvery = (iEvery > 0) ? iEvery : 1;
+	stream.uLastGeneration = uGeneration;
+	stream.iFrameCount = 0;
+	stream.iHead = stream.iQueued = 0;
+	stream.iClosing = 0;
+	stream.iWaitCount = 0;
+	stream.cPrevious = NULL;
+	stream.cEncoded = stream.cDelta = NULL;
+	stream.iEncodedSize = 0;
+	stream.iError = fwrite(&header, sizeof(header), 1, stream.pFile) != 1;
+	stream.lBytesWritten = sizeof(header);
+
+	pthread_mutex_init(&stream.mutex, NULL);
+	pthread_cond_init(&stream.frameQueued, NULL);
+	pthread_cond_init(&stream.frameTaken, NULL);
+	pthread_create(&stream.writer, NULL, writeFrames, &stream);
+	return 1;
+}
+
+// Whether the generation uGeneration is due for a frame: iEvery generations have passed since the last one
+// (generations may advance several at a time)
+int isFrameDue(const LifeStream &stream, uint64_t uGeneration)
+{
+	return uGeneration - stream.uLastGeneration >= (uint64_t) stream.iEvery;
+}
+
+// Buffer for the packed rows of a frame, handed over to the stream by queueFrame
+unsigned char *beginFrame(int iRowCount, int iColumnCount)
+{
+	return (unsigned char *) malloc(lifeFrameBytes(iRowCount, iColumnCount));
+}
+
+// Queue the packed rows of the generation uGeneration for the writer, who frees them.
+// Waits only while the ring is full.
+void queueFrame(LifeStream &stream, unsigned char *cRows, int iRowCount, int iColumnCount, uint64_t uGeneration,
+				long long lRowOrigin, long long lColumnOrigin)
+{
+	LifeFrame frame;
+	memset(&frame.header, 0, sizeof(frame.header));
+	frame.header.uKind = (stream.iFrameCount % LIFE_STREAM_KEY_EVERY == 0) ? LIFE_FRAME_KEY : LIFE_FRAME_DELTA;
+	frame.header.uGeneration = uGeneration;
+	frame.header.uRowCount = iRowCount;
+	frame.header.uColumnCount = iColumnCount;
+	frame.header.iRowOrigin = lRowOrigin;
+	frame.header.iColumnOrigin = lColumnOrigin;
+	frame.cRows = cRows;
+
+	pthread_mutex_lock(&stream.mutex);
+	if(stream.iQueued == LIFE_STREAM_QUEUE)
+	{
+		stream.iWaitCount++;
+		while(stream.iQueued == LIFE_STREAM_QUEUE)
+			pthread_cond_wait(&stream.frameTaken, &stream.mutex);
+	}
+	stream.queue[(stream.iHead + stream.iQueued) % LIFE_STREAM_QUEUE] = frame;
+	stream.iQueued++;
+	pthread_cond_signal(&stream.frameQueued);
+	pthread_mutex_unlock(&stream.mutex);
+
+	stream.iFrameCount++;
+	stream.uLastGeneration = uGeneration;
+}
+
+// Pack the grid (without the outer layers of iDepth rows and columns) and queue it as the frame of the generation uGeneration
+void streamGrid(LifeStream &stream, const LifeGrid &grid, int iDepth, uint64_t uGeneration, long long lRowOrigin, long long lColumnOrigin)
+{
+	int iRowCount = grid.iRowCount - 2 * iDepth, iColumnCount = grid.iColumnCount - 2 * iDepth;
+	size_t iRowBytes = lifeRowBytes(iColumnCount);
+	unsigned char *cRows = beginFrame(iRowCount, iColumnCount);
+
+	for(int i = 0; i < iRowCount; i++)
+		packRow(grid, i + iDepth, iDepth, iColumnCount, cRows + i * iRowBytes);
+
+	queueFrame(stream, cRows, iRowCount, iColumnCount, uGeneration, lRowOrigin, lColumnOrigin);
+}
+
+// Let the writer write the frames still queued, then close the file. Returns 0 when a write failed.
+int closeStream(LifeStream &stream)
+{
+	pthread_mutex_lock(&stream.mutex);
+	stream.iClosing = 1;
+	pthread_cond_signal(&stream.frameQueued);
+	pthread_mutex_unlock(&stream.mutex);
+	pthread_join(stream.writer, NULL);
+
+	pthread_mutex_destroy(&stream.mutex);
+	pthread_cond_destroy(&stream.frameQueued);
+	pthread_cond_destroy(&stream.frameTaken);
+
+	free(stream.cPrevious);
+	free(stream.cEncoded);
+	free(stream.cDelta);
+	stream.cPrevious = stream.cEncoded = stream.cDelta = NULL;
+
+	if(fclose(stream.pFile) != 0)
+		stream.iError = 1;
+	return !stream.iError;
+}
+
+// Whether the file starts with the magic of the stream
+int isStreamFile(const char *sFileName)
+{
+	uint32_t uMagic = 0;
+	FILE *pFile = fopen(sFileName, "rb");
+	if(!pFile)
+		return 0;
+
+	size_t iRead = fread(&uMagic, sizeof(uMagic), 1, pFile);
+	fclose(pFile);
+
+	return iRead == 1 && uMagic == LIFE_STREAM_MAGIC;
+}
+
+// Open a stream and check its header. Returns 0 (with a message) when the file is unusable.
+int openStreamReader(LifeStreamReader &reader, const char *sFileName)
+{
+	reader.cRows = reader.cEncoded = NULL;
+	reader.pFile = fopen(sFileName, "rb");
+	if(!reader.pFile)
+	{
+		cerr << "Unable to open " << sFileName << endl;
+		return 0;
+	}
+
+	if(fread(&reader.header, sizeof(reader.header), 1, reader.pFile) != 1 || reader.header.uMagic != LIFE_STREAM_MAGIC ||
+	   reader.header.uVersion != LIFE_STREAM_VERSION || reader.header.uHeaderSize < sizeof(LifeStreamHeader) ||
+	   fseek(reader.pFile, reader.header.uHeaderSize, SEEK_SET) != 0)
+	{
+		cerr << sFileName << " is not a snapshot stream" << endl;
+		closeStreamReader(reader);
+		return 0;
+	}
+
+	memset(&reader.frame, 0, sizeof(reader.frame));
+	return 1;
+}
+
+// Read and decode the next frame into reader.frame and reader.cRows.
+// Returns 0 at the end of the stream, or (with a message) when the frame is broken.
+int readFrame(LifeStreamReader &reader)
+{
+	LifeFrameHeader header;
+	if(fread(&header, sizeof(header), 1, reader.pFile) != 1)
+		return 0;
+
+	const char *sError = NULL;
+	if(header.uRowCount == 0 || header.uColumnCount == 0 || header.uRowCount > INT32_MAX || header.uColumnCount > INT32_MAX)
+		sError = "has a broken header";
+	else if(header.uKind == LIFE_FRAME_DELTA && (!reader.cRows || header.uRowCount != reader.frame.uRowCount ||
+												 header.uColumnCount != reader.frame.uColumnCount))
+		sError = "is a delta without its frame before";
+	else if(header.uKind != LIFE_FRAME_KEY && header.uKind != LIFE_FRAME_DELTA)
+		sError = "has an unknown kind";
+	if(sError)
+	{
+		cerr << "The frame of generation " << header.uGeneration << " " << sError << endl;
+		return 0;
+	}
+
+	size_t iBytes = lifeFrameBytes(header.uRowCount, header.uColumnCount);
+	free(reader.cEncoded);
+	reader.cEncoded = (unsigned char *) malloc(header.uBytes ? header.uBytes : 1);
+	if(header.uKind == LIFE_FRAME_KEY)
+	{
+		free(reader.cRows);
+		reader.cRows = (unsigned char *) malloc(iBytes);
+	}
+
+	if(fread(reader.cEncoded, 1, header.uBytes, reader.pFile) != header.uBytes ||
+	   !decodeRows(reader.cEncoded, header.uBytes, reader.cRows, iBytes, header.uKind == LIFE_FRAME_DELTA))
+		sError = "is cut short or broken";
+	else if(checksumFrame(reader.cRows, header.uRowCount, header.uColumnCount) != header.uChecksum)
+		sError = "does not match its checksum";
+	if(sError)
+	{
+		cerr << "The frame of generation " << header.uGeneration << " " << sError << endl;
+		return 0;
+	}
+
+	reader.frame = header;
+	return 1;
+}
+
+// Close the stream
+void closeStreamReader(LifeStreamReader &reader)
+{
+	if(reader.pFile)
+		fclose(reader.pFile);
+	free(reader.cRows);
+	free(reader.cEncoded);
+	reader.pFile = NULL;
+	reader.cRows = reader.cEncoded = NULL;
+}
@@ -0,0 +1,150 @@
+/*
+ * The snapshot stream of the Game of Life: every iEvery-th generation of a run as a frame of one file.
+ *
+ * The stream starts with a header of 16 bytes:
+ *
+ *		uMagic			"LIFS"
+ *		uVersion		version of the format (LIFE_STREAM_VERSION)
+ *		uHeaderSize		bytes in front of the first frame
+ *		uKeyEvery		frames from one key frame to the next one
+ *
+ * Every frame is a header of 64 bytes (LifeFrameHeader) and uBytes of encoded
+ * rows. The rows are packed as in the binary grid file (life_file.h); a key
+ * frame encodes them as they are, a delta frame encodes their difference (XOR)
+ * to the rows of the frame before. Either way the bytes are run-length encoded
+ * as pairs of a run of zero bytes and a run of literal bytes:
+ *
+ *		<zero bytes> <literal bytes> <the literal bytes>
+ *
+ * both counts as LEB128 numbers. Dead space and cells which did not change
+ * are zero bytes, so a sparse or slowly changing grid takes little room. The
+ * frame holds its own dimension and its place on the plane (a growing grid
+ * changes both); a frame of another dimension than the one before is a key
+ * frame. The checksum is the one of the binary grid file.
+ *
+ * The compute thread only packs the grid into a buffer and queues it; a writer
+ * thread encodes and writes the frames in the background. The compute thread
+ * waits only when LIFE_STREAM_QUEUE frames are queued already.
+ *
+ * @author Md. Ahsan Ayub
+ * @version 1.0 10/17/2026
+ *
+ */
+
+#if !defined LIFE_STREAM_H
+#define LIFE_STREAM_H
+
+// Including libraries
+#include <cstdio>
+#include <stdint.h>
+#include <pthread.h>
+
+// Including the bit-packed grid and the binary grid file
+#include "life_grid.h"
+#include "life_file.h"
+
+// "LIFS" in the first four bytes
+#define LIFE_STREAM_MAGIC 0x5346494cu
+#define LIFE_STREAM_VERSION 1
+
+// Frames from one key frame to the next one
+#define LIFE_STREAM_KEY_EVERY 64
+
+// Frames queued for the writer at most
+#define LIFE_STREAM_QUEUE 4
+
+// Kinds of frames
+enum LifeFrameKind
+{
+	LIFE_FRAME_KEY = 0,			// The rows themselves
+	LIFE_FRAME_DELTA = 1		// The difference to the rows of the frame before
+};
+
+// Header at the start of the stream
+struct LifeStreamHeader
+{
+	uint32_t uMagic;
+	uint32_t uVersion;
+	uint32_t uHeaderSize;
+	uint32_t uKeyEvery;
+};
+
+// Header in front of every frame
+struct LifeFrameHeader
+{
+	uint32_t uKind;
+	uint32_t uReserved;
+	uint64_t uGeneration;
+	uint64_t uRowCount;
+	uint64_t uColumnCount;
+	int64_t iRowOrigin;			// Row of the plane of the first row (0 but for a growing grid)
+	int64_t iColumnOrigin;		// Column of the plane of the first column
+	uint64_t uBytes;			// Bytes of the encoded rows behind the header
+	uint64_t uChecksum;			// Checksum of the rows (checksumRow summed over the rows)
+};
+
+// A frame waiting for the writer
+struct LifeFrame
+{
+	LifeFrameHeader header;
+	unsigned char *cRows;		// Packed rows
+};
+
+// A stream being written
+struct LifeStream
+{
+	FILE *pFile;
+	int iEvery;							// Generations between two frames
+	uint64_t uLastGeneration;			// Generation of the last frame
+	int iFrameCount;					// Frames queued so far
+
+	LifeFrame queue[LIFE_STREAM_QUEUE];	// Frames waiting for the writer (a ring)
+	int iHead;							// First frame of the ring
+	int iQueued;						// Frames in the ring
+	int iClosing;						// No more frames to come
+	int iWaitCount;						// Times the compute thread waited for room in the ring
+
+	unsigned char *cPrevious;			// Rows of the last frame written (writer)
+	LifeFrameHeader previous;			// Its header
+	unsigned char *cDelta;				// Difference of the rows to the frame before (writer)
+	unsigned char *cEncoded;			// Encoded rows (writer)
+	size_t iEncodedSize;				// Bytes allocated for each of them
+	long lBytesWritten;					// Bytes of the stream so far
+	int iError;							// Whether a write failed
+
+	pthread_t writer;
+	pthread_mutex_t mutex;
+	pthread_cond_t frameQueued;			// The writer has a frame to write
+	pthread_cond_t frameTaken;			// The ring has room for a frame
+};
+
+// A stream being read
+struct LifeStreamReader
+{
+	FILE *pFile;
+	LifeStreamHeader header;
+	LifeFrameHeader frame;				// Header of the last frame read
+	unsigned char *cRows;				// Its rows
+	unsigned char *cEncoded;			// Encoded rows as read
+};
+
+// Bytes of the packed rows of a frame
+inline size_t lifeFrameBytes(uint64_t uRowCount, uint64_t uColumnCount)
+{
+	return (size_t) uRowCount * lifeRowBytes((int) uColumnCount);
+}
+
+// Signature of the methods
+int openStream(LifeStream &stream, const char *sFileName, int iEvery, uint64_t uGeneration);
+int isFrameDue(const LifeStream &stream, uint64_t uGeneration);
+unsigned char *beginFrame(int iRowCount, int iColumnCount);
+void queueFrame(LifeStream &stream, unsigned char *cRows, int iRowCount, int iColumnCount, uint64_t uGeneration,
+				long long lRowOrigin, long long lColumnOrigin);
+void streamGrid(LifeStream &stream, const LifeGrid &grid, int iDepth, uint64_t uGeneration, long long lRowOrigin, long long lColumnOrigin);
+int closeStream(LifeStream &stream);
+int isStreamFile(const char *sFileName);
+int openStreamReader(LifeStreamReader &reader, const char *sFileName);
+int readFrame(LifeStreamReader &reader);
+void closeStreamReader(LifeStreamReader &reader);
+
+#endif
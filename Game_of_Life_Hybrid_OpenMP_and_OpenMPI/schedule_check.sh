@@ -0,0 +1,77 @@
+#!/bin/bash
+# Checks the schedules of the threads (--schedule and --tile) of the hybrid and the openmpi_openmp programs against the
+# serial program.
+#
+# A random soup is made whose rows no number of threads from 2 to 8 divides, and whose columns do not fill the last
+# word of a row. Both programs run it with 1 to 8 threads under every schedule and several tile shapes, including
+# tiles of a single row and tiles which do not divide the rows or the columns. Every run has to write the very same
+# last generation as the serial program.
+#
+# Usage: ./schedule_check.sh [processes] [generations] [rows] [columns]
+# Options of mpirun go into MPIRUN_OPTIONS, for example MPIRUN_OPTIONS=--oversubscribe
+#
+# @author Md. Ahsan Ayub
+# @version 1.0 10/18/2026
+
+iProcesses=${1:-1}
+iGenerations=${2:-50}
+iRows=${3:-419}
+iColumns=${4:-333}
+
+sSchedules="static static,1 dynamic dynamic,3 guided guided,2"
+sTiles="32x2048 1x64 7x128 13x1000"
+
+sDirectory=$(mktemp -d)
+trap 'rm -rf "$sDirectory"' EXIT
+
+# The soup: a cell in three alive. The seed is fixed, every run checks the same grid.
+awk -v r="$iRows" -v c="$iColumns" 'BEGIN {
+	srand(1);
+	print r " " c;
+	for(i = 0; i < r; i++)
+	{
+		sLine = "";
+		for(j = 0; j < c; j++)
+			sLine = sLine (rand() < 1 / 3 ? "1 " : "0 ");
+		print sLine;
+	}
+}' > "$sDirectory/soup.txt"
+
+sMpirun="mpirun -np $iProcesses $MPIRUN_OPTIONS"
+[ "$(id -u)" = 0 ] && sMpirun="$sMpirun --allow-run-as-root"
+
+echo "Grid: $iRows * $iColumns | Processes: $iProcesses | Generations: $iGenerations"
+
+# The reference
+./serial "$sDirectory/soup.txt" "$iGenerations" "$sDirectory/serial.txt" > /dev/null || exit 1
+
+iRuns=0
+iFailures=0
+for sProgram in hybrid openmpi_openmp
+do
+	for iThreads in 1 2 3 4 5 6 7 8
+	do
+		for sSchedule in $sSchedules
+		do
+			for sTile in $sTiles
+			do
+				iRuns=$((iRuns + 1))
+				if ! $sMpirun ./$sProgram "$sDirectory/soup.txt" "$iThreads" "$iGenerations" "$sDirectory/out.txt" \
+					--schedule "$sSchedule" --tile "$sTile" > /dev/null 2>&1 || ! cmp -s "$sDirectory/serial.txt" "$sDirectory/out.txt"
+				then
+					echo "Differs: $sProgram | Threads: $iThreads | Schedule: $sSchedule | Tile: $sTile"
+					iFailures=$((iFailures + 1))
+				fi
+				rm -f "$sDirectory/out.txt"
+			done
+		done
+	done
+done
+
+if [ "$iFailures" = 0 ]
+then
+	echo "All $iRuns runs write the last generation of the serial program"
+else
+	echo "$iFailures of $iRuns runs differ from the serial program"
+	exit 1
+fi
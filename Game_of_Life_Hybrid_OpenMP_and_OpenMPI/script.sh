@@ -3,4 +3,9 @@
 #SBATCH --time=01:00:00
 #SBATCH --cpus-per-task=16
 
-mpirun -pernode ./hybrid intput.txt 16 600 output_4_16.txt
+# The 16 threads of every process stay on neighbouring cores, spread would scatter them over the sockets
+export OMP_PLACES=cores
+export OMP_PROC_BIND=close
+
+# A checkpoint every 10 minutes, a resubmitted job continues from the last one
+mpirun -pernode ./hybrid intput.txt 16 600 output_4_16.txt --checkpoint checkpoint_4_16.bin --checkpoint-seconds 600 --restart